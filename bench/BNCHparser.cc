@@ -0,0 +1,476 @@
+/*
+  BNCHparser.cc
+  Description: Benchmarks of the parser and its accessors
+  Started on  <Sat Oct 17 17:48:31 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+// Usage: parser [--benchmark_filter=regex] [any other option of Google Benchmark]
+//
+// It measures the performance of parse_string, every accessor of the parser,
+// the traversals and the writer over graphs randomly generated with the
+// helpers of the unit tests across different sizes, densities, path lengths
+// and number of attributes. Every benchmark reports the throughput (MB/s and
+// statements/s for parsing, items/s, i.e., vertices or edges, for the
+// accessors and the traversals and MB/s for the writer) and the number of
+// bytes allocated per iteration, which are counted by replacing the global
+// operators new and delete of this program. Statements are counted by the
+// parser, so that statements/s are reported only if the library and this
+// program are compiled with DOT_STATS (e.g., ./configure CPPFLAGS=-DDOT_STATS).
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../tests/TSTdefs.h"
+#include "../tests/TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// ----------------------------------------------------------------------------
+// ALLOCATIONS
+// ----------------------------------------------------------------------------
+
+// number of bytes allocated so far with the global operator new
+static atomic<size_t> allocated {0};
+
+void* operator new (size_t size)
+{
+  allocated.fetch_add (size, memory_order_relaxed);
+  if (void* ptr = malloc (size ? size : 1))
+    return ptr;
+  throw bad_alloc ();
+}
+
+void* operator new (size_t size, align_val_t alignment)
+{
+  allocated.fetch_add (size, memory_order_relaxed);
+  size_t align = size_t (alignment);
+  if (void* ptr = aligned_alloc (align, (size + align - 1) / align * align))
+    return ptr;
+  throw bad_alloc ();
+}
+
+// the replacements of the operator delete release the memory given by the
+// replacements of the operator new above with free, which GCC can not see
+// when both are inlined in the same caller
+#if defined (__GNUC__) && !defined (__clang__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete (void* ptr) noexcept
+{ free (ptr); }
+
+void operator delete (void* ptr, size_t) noexcept
+{ free (ptr); }
+
+void operator delete (void* ptr, align_val_t) noexcept
+{ free (ptr); }
+
+void operator delete (void* ptr, size_t, align_val_t) noexcept
+{ free (ptr); }
+
+#if defined (__GNUC__) && !defined (__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+// set the counter of bytes allocated per iteration, given the number of bytes
+// allocated when the benchmark started
+void countAllocations (benchmark::State& state, size_t start)
+{
+  state.counters["bytes_allocated"] =
+    benchmark::Counter (double (allocated.load () - start),
+			benchmark::Counter::kAvgIterations);
+}
+
+// ----------------------------------------------------------------------------
+// GRAPHS
+// ----------------------------------------------------------------------------
+
+// Generate a random directed graph with nbvertices vertices, each one with up
+// to nbattrs attributes, and nbvertices*density edges (not counting those
+// leading to blocks of multiple vertices) arranged in paths of the given
+// length, each one with up to nbattrs attributes. The same graph is returned
+// for the same parameters
+const string& generate (int nbvertices, int density, int pathlength, int nbattrs)
+{
+  static map<tuple<int, int, int, int>, string> graphs;
+  auto key = make_tuple (nbvertices, density, pathlength, nbattrs);
+  auto igraph = graphs.find (key);
+  if (igraph != graphs.end ())
+    return igraph->second;
+
+  srand (nbvertices + density + pathlength + nbattrs);
+  vector<string> vertices;
+  map<string, vector<string>> edges;
+  map<string, map<string, string>> vertexselectedattrs, vertexattrs;
+  map<string, string> edgeselectedattrs;
+  map<string, map<string, map<string, string>>> edgeattrs;
+  set<string> used_vertices;
+  randVertices (nbvertices, nbattrs, vertices, vertexselectedattrs);
+  randLabels (nbattrs, edgeselectedattrs);
+
+  // paths are terminated with blocks of multiple vertices, generated with
+  // randMultipleVertices, with a probability of 10%
+  string contents = "digraph bench {\n";
+  for (auto i = 0 ; i < max (1, nbvertices * density / pathlength) ; i++)
+    contents += randPath (pathlength, 10, 5, DIRECTED_EDGE, vertices, edges,
+			  vertexselectedattrs, edgeselectedattrs,
+			  used_vertices, vertexattrs, edgeattrs) + "\n";
+  contents += "}\n";
+  return graphs[key] = contents;
+}
+
+// Generate a random graph with randGraph with the given number of edge
+// statements as the unit tests do. The same graph is returned for the same
+// number of edges
+const string& generate (int nbedges)
+{
+  static map<int, string> graphs;
+  auto igraph = graphs.find (nbedges);
+  if (igraph != graphs.end ())
+    return igraph->second;
+
+  srand (nbedges);
+  vector<string> vertices;
+  map<string, vector<string>> edges;
+  map<string, string> labels;
+  map<string, map<string, string>> vertexattrs;
+  map<string, map<string, map<string, string>>> edgeattrs;
+  return graphs[nbedges] = randGraph (nbedges / 10, 50, 5, nbedges, 10, 5, 4, 4, "bench",
+				      DIRECTED_GRAPH, MIX_EDGE,
+				      vertices, edges, labels, vertexattrs, edgeattrs);
+}
+
+// ----------------------------------------------------------------------------
+// PARSING
+// ----------------------------------------------------------------------------
+
+// measure parse_string over the given contents
+void parse (benchmark::State& state, const string& contents)
+{
+  size_t start = allocated.load ();
+  size_t nbstatements = 0;
+  for (auto _ : state) {
+    dot::parser parser;
+    benchmark::DoNotOptimize (parser.parse_string (contents));
+    nbstatements = parser.get_stats ().nb_statements;
+  }
+  countAllocations (state, start);
+  state.SetBytesProcessed (int64_t (state.iterations ()) * contents.size ());
+
+  // statements are counted by the parser only if statistics are enabled
+  if (dot::stats::enabled)
+    state.counters["statements"] =
+      benchmark::Counter (double (nbstatements),
+			  benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// parse graphs generated with the arguments: vertices, density, path length
+// and attributes
+void BM_parse_string (benchmark::State& state)
+{
+  parse (state, generate (state.range (0), state.range (1), state.range (2), state.range (3)));
+}
+BENCHMARK (BM_parse_string)
+->ArgNames ({"vertices", "density", "length", "attrs"})
+// sizes
+->Args ({100, 4, 4, 4})
+->Args ({1000, 4, 4, 4})
+->Args ({10000, 4, 4, 4})
+// densities
+->Args ({1000, 1, 4, 4})
+->Args ({1000, 16, 4, 4})
+// path lengths
+->Args ({1000, 4, 1, 4})
+->Args ({1000, 4, 16, 4})
+// attributes
+->Args ({1000, 4, 4, 0})
+->Args ({1000, 4, 4, 16})
+->Unit (benchmark::kMicrosecond);
+
+// parse graphs generated with randGraph with the given number of edge
+// statements
+void BM_parse_string_random (benchmark::State& state)
+{
+  parse (state, generate (state.range (0)));
+}
+BENCHMARK (BM_parse_string_random)
+->ArgName ("edges")
+->Arg (100)->Arg (1000)->Arg (10000)
+->Unit (benchmark::kMicrosecond);
+
+// ----------------------------------------------------------------------------
+// ACCESSORS
+// ----------------------------------------------------------------------------
+
+// The accessors are measured over graphs with the given number of vertices,
+// and a fixed density, path length and number of attributes. The function
+// given is invoked once per iteration and it has to return the number of items
+// (vertices or edges) visited
+template<class F>
+void access (benchmark::State& state, F f)
+{
+  dot::parser parser;
+  parser.parse_string (generate (state.range (0), 4, 4, 4));
+
+  size_t items = 0;
+  size_t start = allocated.load ();
+  for (auto _ : state)
+    items += f (parser);
+  countAllocations (state, start);
+  state.SetItemsProcessed (int64_t (items));
+}
+
+// register an accessor benchmark over graphs of different sizes
+#define ACCESSOR(name)					\
+  BENCHMARK (name)					\
+  ->ArgName ("vertices")				\
+  ->Arg (100)->Arg (1000)->Arg (10000)			\
+  ->Unit (benchmark::kMicrosecond)
+
+void BM_get_vertices (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_vertices ().size ();
+  });
+}
+ACCESSOR (BM_get_vertices);
+
+void BM_get_graph (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_graph ().size ();
+  });
+}
+ACCESSOR (BM_get_graph);
+
+void BM_get_neighbours (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      items += parser.get_neighbours (string (parser.get_vertex_name (id))).size ();
+    return items;
+  });
+}
+ACCESSOR (BM_get_neighbours);
+
+void BM_get_neighbour_ids (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      for (auto neighbour : parser.get_neighbour_ids (id)) {
+	benchmark::DoNotOptimize (neighbour);
+	items++;
+      }
+    return items;
+  });
+}
+ACCESSOR (BM_get_neighbour_ids);
+
+void BM_get_neighbour_range (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      for (auto neighbour : parser.get_neighbour_range (id)) {
+	benchmark::DoNotOptimize (neighbour);
+	items++;
+      }
+    return items;
+  });
+}
+ACCESSOR (BM_get_neighbour_range);
+
+void BM_get_vertex_range (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (auto vertex : parser.get_vertex_range ()) {
+      benchmark::DoNotOptimize (vertex.name);
+      items++;
+    }
+    return items;
+  });
+}
+ACCESSOR (BM_get_vertex_range);
+
+void BM_get_edge_range (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (auto edge : parser.get_edge_range ()) {
+      benchmark::DoNotOptimize (edge.target);
+      items++;
+    }
+    return items;
+  });
+}
+ACCESSOR (BM_get_edge_range);
+
+void BM_get_vertex_attributes (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      items += !parser.get_vertex_attributes (string (parser.get_vertex_name (id))).empty ();
+    return items;
+  });
+}
+ACCESSOR (BM_get_vertex_attributes);
+
+void BM_get_vertex_attribute_map (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      items += !parser.get_vertex_attribute_map (id).empty ();
+    return items;
+  });
+}
+ACCESSOR (BM_get_vertex_attribute_map);
+
+void BM_get_all_vertex_attributes (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_all_vertex_attributes ().size ();
+  });
+}
+ACCESSOR (BM_get_all_vertex_attributes);
+
+void BM_get_edge_attributes (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++) {
+      string origin {parser.get_vertex_name (id)};
+      for (auto neighbour : parser.get_neighbour_ids (id))
+	items += !parser.get_edge_attributes (origin, string (parser.get_vertex_name (neighbour))).empty ();
+    }
+    return items;
+  });
+}
+ACCESSOR (BM_get_edge_attributes);
+
+void BM_get_edge_attribute_map (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    size_t items = 0;
+    for (auto edge : parser.get_edge_range ())
+      items += !edge.attributes.empty ();
+    return items;
+  });
+}
+ACCESSOR (BM_get_edge_attribute_map);
+
+void BM_get_all_edge_attributes (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_all_edge_attributes ().size ();
+  });
+}
+ACCESSOR (BM_get_all_edge_attributes);
+
+void BM_get_csr (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_csr ().get_nb_edges ();
+  });
+}
+ACCESSOR (BM_get_csr);
+
+void BM_get_vertex_columns (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_vertex_columns ().size ();
+  });
+}
+ACCESSOR (BM_get_vertex_columns);
+
+void BM_get_edge_columns (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return parser.get_edge_columns ().size ();
+  });
+}
+ACCESSOR (BM_get_edge_columns);
+
+void BM_reachable (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return dot::reachable (parser, 0).size ();
+  });
+}
+ACCESSOR (BM_reachable);
+
+void BM_bfs_levels (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return dot::bfs_levels (parser, 0).size ();
+  });
+}
+ACCESSOR (BM_bfs_levels);
+
+void BM_dfs (benchmark::State& state)
+{
+  access (state, [] (dot::parser& parser) {
+    return dot::dfs (parser, 0).preorder.size ();
+  });
+}
+ACCESSOR (BM_dfs);
+
+// ----------------------------------------------------------------------------
+// WRITING
+// ----------------------------------------------------------------------------
+
+// write graphs with the given number of vertices, and a fixed density, path
+// length and number of attributes, with the given layout. The writer is
+// created only once, so that its buffer is reused in every iteration
+void write (benchmark::State& state, dot::writer::layout layout)
+{
+  dot::parser parser;
+  parser.parse_string (generate (state.range (0), 4, 4, 4));
+  dot::writer writer {layout};
+  stringstream stream;
+
+  uint64_t nbbytes = 0;
+  size_t start = allocated.load ();
+  for (auto _ : state) {
+    stream.seekp (0);
+    nbbytes += writer.write (parser, stream);
+  }
+  countAllocations (state, start);
+  state.SetBytesProcessed (int64_t (nbbytes));
+}
+
+void BM_write_pretty (benchmark::State& state)
+{
+  write (state, dot::writer::layout::pretty);
+}
+ACCESSOR (BM_write_pretty);
+
+void BM_write_compact (benchmark::State& state)
+{
+  write (state, dot::writer::layout::compact);
+}
+ACCESSOR (BM_write_compact);
+
+BENCHMARK_MAIN ();
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
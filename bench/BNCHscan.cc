@@ -0,0 +1,155 @@
+/*
+  BNCHscan.cc
+  Description: Microbenchmark of the classification scans of the lexer
+  Started on  <Fri Oct 16 13:05:12 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+// Usage: scan [file.dot]
+//
+// It measures the throughput of the scans of blanks, identifiers and quoted
+// strings with every instruction set supported by this CPU over the contents
+// of the given file. If none is given, an attribute-heavy graph is randomly
+// generated. Throughput is reported in bytes per cycle (as measured by the
+// time stamp counter if available) and MB/s, both for the scans alone and for
+// parsing the whole contents.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "../tests/TSTdefs.h"
+#include "../tests/TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// number of times each measurement is repeated. Only the fastest one is
+// reported
+const int NB_REPETITIONS = 10;
+
+// return the current value of the time stamp counter, or 0 if it is not
+// available
+unsigned long long cycles ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc ();
+#else
+  return 0;
+#endif
+}
+
+// a measurement consists of the number of cycles and seconds elapsed
+struct measurement {
+  unsigned long long cycles;
+  double seconds;
+};
+
+// run the given function NB_REPETITIONS times and return the fastest one
+template<class F>
+measurement measure (F f)
+{
+  measurement best {0, 0.0};
+  for (auto i = 0 ; i < NB_REPETITIONS ; i++) {
+    auto start = chrono::steady_clock::now ();
+    unsigned long long c0 = cycles ();
+    f ();
+    unsigned long long c1 = cycles ();
+    double seconds = chrono::duration<double> (chrono::steady_clock::now () - start).count ();
+    if (!i || seconds < best.seconds)
+      best = {c1 - c0, seconds};
+  }
+  return best;
+}
+
+// tokenize the given contents as the lexer does, i.e., skipping blanks,
+// identifiers and quoted strings with the scanner and any other character
+// one at a time. It returns the number of runs found to prevent the compiler
+// from optimizing it away
+size_t tokenize (const string& contents)
+{
+  size_t runs = 0;
+  const char* p = contents.data ();
+  const char* end = p + contents.size ();
+  while (p != end) {
+    const char* q = dot::scanner::spaces (p, end);
+    q = dot::scanner::identifier (q, end);
+    if (q != end && *q == '"') {
+      q = dot::scanner::quote (q + 1, end);
+      if (q != end)
+	q++;
+    }
+    if (q == p)
+      q++;
+    p = q;
+    runs++;
+  }
+  return runs;
+}
+
+// show the throughput of a measurement over the given number of bytes
+void show (const string& name, dot::scanner::isa level, size_t bytes, const measurement& m)
+{
+  printf (" %-10s %-8s %10.3f bytes/cycle %10.1f MB/s\n",
+	  name.c_str (), dot::scanner::get_isa_name (level).c_str (),
+	  m.cycles ? double (bytes) / m.cycles : 0.0,
+	  bytes / m.seconds / 1e6);
+}
+
+int main (int argc, char** argv)
+{
+
+  // read the contents of the given file or generate them randomly
+  string contents;
+  if (argc > 1) {
+    ifstream stream (argv[1]);
+    if (!stream) {
+      fprintf (stderr, " Fatal error: file not found '%s'\n", argv[1]);
+      return EXIT_FAILURE;
+    }
+    stringstream buffer;
+    buffer << stream.rdbuf ();
+    contents = buffer.str ();
+  } else {
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    srand (0);
+    contents = randGraph (1000, 50, 5, 20000, 10, 5, 10, 10, "attributes",
+			  DIRECTED_GRAPH, MIX_EDGE,
+			  vertices, edges, labels, vertexattrs, edgeattrs);
+  }
+  printf (" %zu bytes\n\n", contents.size ());
+
+  // and measure every instruction set supported
+  for (auto level : {dot::scanner::isa::scalar, dot::scanner::isa::sse2, dot::scanner::isa::avx2}) {
+    if (level > dot::scanner::get_best_isa ())
+      continue;
+    dot::scanner::set_isa (level);
+
+    size_t runs = 0;
+    show ("tokenize", level, contents.size (),
+	  measure ([&] () { runs += tokenize (contents); }));
+    show ("parse", level, contents.size (),
+	  measure ([&] () { dot::parser parser; parser.parse_string (contents); }));
+    if (!runs)
+      printf (" no runs found!\n");
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -4,8 +4,39 @@
 // *** General definitions ***
 #include <src/DOTdefs.h>
 
+// *** Input ***
+#include <src/DOTinput.h>
+
+// *** Lexer ***
+#include <src/DOTscan.h>
+#include <src/DOTlexer.h>
+
 // *** Parser ***
+#include <src/DOTinterner.h>
+#include <src/DOTrange.h>
+#include <src/DOTvalue.h>
+#include <src/DOTcsr.h>
+#include <src/DOTcolumns.h>
+#include <src/DOThandler.h>
+#include <src/DOTrecorder.h>
+#include <src/DOTstats.h>
+#include <src/DOTthreads.h>
+#include <src/DOTtrace.h>
+#include <src/DOTreader.h>
 #include <src/DOTparser.h>
+#include <src/DOTview.h>
+#include <src/DOTbatch.h>
+#include <src/DOTsnapshot.h>
+
+// *** Traversals ***
+#include <src/DOTtraversal.h>
+
+// *** Writer ***
+#include <src/DOToutput.h>
+#include <src/DOTwriter.h>
+
+// *** Generator ***
+#include <src/DOTgenerator.h>
 
 #endif // LIBDOT_H_
 
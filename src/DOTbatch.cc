@@ -0,0 +1,168 @@
+/*
+  DOTbatch.cc
+  Description: Parsing of many dot files in parallel
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 11:20:43 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <sys/stat.h>
+
+#include "DOTbatch.h"
+#include "DOTthreads.h"
+
+namespace {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a pool of tasks where every thread has its own queue of
+  // tasks. Threads take their own tasks from the front of their queues and,
+  // once they are empty, they steal tasks from the back of the queues of other
+  // threads. Tasks are just indices, and queues are protected with a mutex
+  // each, as every task (a whole file) is expected to take much longer than
+  // locking
+  class scheduler {
+
+  private:
+
+    // INVARIANTS: every thread has a queue of tasks protected by its own
+    // mutex
+    struct queue {
+      mutex _lock;
+      deque<size_t> _tasks;
+    };
+    vector<queue> _queues;
+
+  public:
+
+    // Explicit constructor
+    explicit scheduler (unsigned int nbthreads)
+      : _queues (nbthreads)
+    {}
+
+    // add a task to the queue of the given thread
+    void push (unsigned int id, size_t task)
+    { _queues[id]._tasks.push_back (task); }
+
+    // return in task the next task of the given thread, either from its own
+    // queue or stolen from another one. It returns false if no tasks are left
+    bool pop (unsigned int id, size_t& task)
+    {
+
+      // first, take the next task of this thread
+      {
+	lock_guard<mutex> guard {_queues[id]._lock};
+	if (!_queues[id]._tasks.empty ()) {
+	  task = _queues[id]._tasks.front ();
+	  _queues[id]._tasks.pop_front ();
+	  return true;
+	}
+      }
+
+      // otherwise, steal one from the other threads
+      for (size_t i = 1 ; i < _queues.size () ; i++) {
+	queue& victim = _queues[(id + i) % _queues.size ()];
+	lock_guard<mutex> guard {victim._lock};
+	if (!victim._tasks.empty ()) {
+	  task = victim._tasks.back ();
+	  victim._tasks.pop_back ();
+	  return true;
+	}
+      }
+      return false;
+    }
+  }; // class scheduler
+
+  // return the size of the given file, or zero if it can not be determined
+  size_t file_size (const string& filename)
+  {
+    struct stat status;
+    if (stat (filename.c_str (), &status) < 0)
+      return 0;
+    return status.st_size;
+  }
+}
+
+// return the message of the exception raised while parsing, or the empty
+// string if the file was successfully parsed
+std::string dot::parse_result::get_error_message () const
+{
+  if (!error)
+    return "";
+  try {
+    rethrow_exception (error);
+  } catch (const exception& exception) {
+    return exception.what ();
+  } catch (...) {
+    return "unknown error";
+  }
+}
+
+// parse all the given files using the given number of threads (all those
+// available if zero). The results are returned in the same order than the
+// files, and errors are reported in them rather than raised
+std::vector<dot::parse_result> dot::parse_many (const vector<string>& filenames,
+						unsigned int nbthreads)
+{
+
+  // create a parser for every file
+  vector<parse_result> results;
+  results.reserve (filenames.size ());
+  for (auto& filename : filenames)
+    results.emplace_back (filename);
+
+  if (!nbthreads)
+    nbthreads = max (1u, thread::hardware_concurrency ());
+  nbthreads = max (1u, min (nbthreads, unsigned (filenames.size ())));
+
+  // sort the files from the largest to the smallest one, and deal them to all
+  // threads in turns, so that every thread starts with one of the largest
+  // files and the total size given to every thread is similar
+  vector<pair<size_t, size_t>> sizes;
+  for (size_t i = 0 ; i < filenames.size () ; i++)
+    sizes.emplace_back (file_size (filenames[i]), i);
+  stable_sort (sizes.begin (), sizes.end (),
+	       [] (const pair<size_t, size_t>& a, const pair<size_t, size_t>& b) {
+		 return a.first > b.first;
+	       });
+  scheduler tasks {nbthreads};
+  for (size_t i = 0 ; i < sizes.size () ; i++)
+    tasks.push (i % nbthreads, sizes[i].second);
+
+  // and parse all files. Every thread takes the largest file in its own queue
+  // and, once it is empty, the smallest one of another thread
+  auto work = [&] (unsigned int id) {
+    size_t task;
+    while (tasks.pop (id, task)) {
+      try {
+	results[task].graph.parse ();
+      } catch (...) {
+	results[task].error = current_exception ();
+      }
+    }
+  };
+  thread_group threads;
+  for (unsigned int id = 1 ; id < nbthreads ; id++)
+    threads.spawn (work, id);
+  work (0);
+  threads.join ();
+
+  return results;
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,68 @@
+/*
+  DOTbatch.h
+  Description: Parsing of many dot files in parallel
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 11:20:43 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	BATCH_H_
+# define   	BATCH_H_
+
+// Many dot files can be parsed at once with a pool of threads, each file with
+// its own parser. Files are scheduled from the largest to the smallest one,
+// and threads which run out of files steal them from the others, so that all
+// threads are kept busy even if the sizes of the files are very different.
+
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "DOTparser.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Struct definition
+  //
+  // Definition of the result of parsing a single file
+  struct parse_result {
+
+    string filename;                                  // file which was parsed
+    parser graph;                                   // graph parsed from it
+    exception_ptr error;     // exception raised while parsing, null if none
+
+    // Explicit constructor
+    explicit parse_result (const string& filename)
+      : filename {filename},
+	graph {filename}
+    {}
+
+    // return true if the file was successfully parsed
+    bool success () const
+    { return !error; }
+
+    // return the message of the exception raised while parsing, or the empty
+    // string if the file was successfully parsed
+    string get_error_message () const;
+  };
+
+  // parse all the given files using the given number of threads (all those
+  // available if zero). The results are returned in the same order than the
+  // files, and errors are reported in them rather than raised
+  vector<parse_result> parse_many (const vector<string>& filenames, unsigned int nbthreads = 0);
+
+} // namespace dot
+
+#endif 	    /* !BATCH_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
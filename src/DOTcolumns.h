@@ -0,0 +1,222 @@
+/*
+  DOTcolumns.h
+  Description: Columnar representation of attributes
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 15:48:12 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	COLUMNS_H_
+# define   	COLUMNS_H_
+
+// Attributes of vertices or edges can be also stored in columns, one per
+// attribute name. Every column is a dense array indexed by the identifier of
+// vertices (or the index of edges in the CSR format) along with a bitmap which
+// tells which elements have the attribute. The numbers of all elements are
+// stored in contiguous memory, so that a single attribute can be traversed
+// over all elements without visiting the attributes of any of them, and the
+// texts of all elements are stored one after the other in a single string.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DOTvalue.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of the values of a single attribute of all elements
+  class column {
+
+  private:
+
+    // INVARIANTS: a column has n elements. The i-th bit of _present (starting
+    // with the least significant bit of its first word) is set if and only if
+    // the i-th element has this attribute. _numbers[i] is the number of the
+    // i-th element if it is a number, and NaN otherwise (even if it does not
+    // have this attribute). The text of the i-th element is given by the
+    // characters in the range [_text_offsets[i], _text_offsets[i+1]) of
+    // _chars, and it is empty if it does not have this attribute
+    vector<uint64_t> _present;              // whether every element has a value
+    vector<double> _numbers;                     // numbers of all elements
+    string _chars;                              // texts of all elements
+    vector<size_t> _text_offsets;        // where the text of every element starts
+    size_t _count;                        // number of elements with a value
+
+    // columns are created by the parser
+    friend class parser;
+
+    // create a column with n elements and no values
+    void _resize (size_t n)
+    {
+      _present.assign ((n + 63) / 64, 0);
+      _numbers.assign (n, numeric_limits<double>::quiet_NaN ());
+      _text_offsets.assign (1, 0);
+      _text_offsets.reserve (n + 1);
+    }
+
+    // set the value of the i-th element. Values have to be set in increasing
+    // order of their elements
+    void _set (size_t i, const value& value)
+    {
+      _text_offsets.resize (i + 1, _chars.size ());
+      _chars += value.get_text ();
+      _text_offsets.push_back (_chars.size ());
+      _present[i / 64] |= uint64_t (1) << (i % 64);
+      if (value.is_number ())
+	_numbers[i] = value.get<double> ();
+      _count++;
+    }
+
+    // complete the texts of all elements after the last one given a value
+    void _close ()
+    { _text_offsets.resize (_numbers.size () + 1, _chars.size ()); }
+
+    // verify that the given element exists, and raise an exception otherwise
+    void _check (size_t i) const
+    {
+      if (i >= _numbers.size ())
+	throw out_of_range ("no element has the index " + to_string (i));
+    }
+
+  public:
+
+    // Default constructor, which creates a column with no elements
+    column ()
+      : _text_offsets {0},
+	_count {0}
+    {}
+
+    // get the number of elements of this column
+    size_t size () const
+    { return _numbers.size (); }
+
+    // get the number of elements which have a value
+    size_t count () const
+    { return _count; }
+
+    // return true if the i-th element has a value. In case no element exists
+    // with the given index an exception is raised
+    bool has_value (size_t i) const
+    {
+      _check (i);
+      return (_present[i / 64] >> (i % 64)) & 1;
+    }
+
+    // return true if the value of the i-th element is a number. In case no
+    // element exists with the given index an exception is raised
+    bool is_number (size_t i) const
+    {
+      _check (i);
+      return !isnan (_numbers[i]);
+    }
+
+    // return the number of the i-th element, which is NaN if it has no value
+    // or it is not a number. In case no element exists with the given index
+    // an exception is raised
+    double get_number (size_t i) const
+    {
+      _check (i);
+      return _numbers[i];
+    }
+
+    // return the text of the i-th element, which is empty if it has no
+    // value. In case no element exists with the given index an exception is
+    // raised
+    string_view get_text (size_t i) const
+    {
+      _check (i);
+      return string_view (_chars).substr (_text_offsets[i],
+					   _text_offsets[i+1] - _text_offsets[i]);
+    }
+
+    // get the numbers of all elements, which are NaN for those which have no
+    // value or which are not numbers
+    const vector<double>& get_numbers () const
+    { return _numbers; }
+
+    // get the bitmap of the elements which have a value, with 64 elements per
+    // word starting with the least significant bit
+    const vector<uint64_t>& get_presence () const
+    { return _present; }
+
+  }; // class column
+
+  // Class definition
+  //
+  // Definition of the attributes of all vertices or edges of a graph, stored
+  // in columns
+  class columns {
+
+  private:
+
+    // INVARIANTS: all columns have the same number of elements, and they are
+    // indexed by the name of their attribute
+    size_t _size;                                       // number of elements
+    map<string, column, less<>> _columns;        // column of every attribute
+
+    // columns are created by the parser
+    friend class parser;
+
+  public:
+
+    // Default constructor, which creates no columns
+    columns ()
+      : _size {0}
+    {}
+
+    // get the number of elements, i.e., vertices or edges
+    size_t size () const
+    { return _size; }
+
+    // get the number of columns
+    size_t get_nb_columns () const
+    { return _columns.size (); }
+
+    // get the names of all columns, sorted in ascending order
+    vector<string> get_names () const
+    {
+      vector<string> names;
+      for (auto& icolumn : _columns)
+	names.push_back (icolumn.first);
+      return names;
+    }
+
+    // return true if there is a column with the given name
+    bool has_column (string_view name) const
+    { return _columns.find (name) != _columns.end (); }
+
+    // get the column with the given name. In case no column exists with the
+    // given name an exception is raised
+    const column& get_column (string_view name) const
+    {
+      auto icolumn = _columns.find (name);
+      if (icolumn == _columns.end ())
+	throw out_of_range ("no column has the name '" + string (name) + "'");
+      return icolumn->second;
+    }
+
+  }; // class columns
+
+} // namespace dot
+
+#endif 	    /* !COLUMNS_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
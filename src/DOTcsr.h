@@ -0,0 +1,112 @@
+/*
+  DOTcsr.h
+  Description: Compressed sparse row representation of graphs
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 20:12:37 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	CSR_H_
+# define   	CSR_H_
+
+// A graph in compressed sparse row (CSR) format consists of two arrays: the
+// targets of all edges, sorted by their origin, and the offsets where the
+// edges of every vertex start in the first array. Thus, the neighbours of the
+// vertex with identifier v are targets[offsets[v]] ... targets[offsets[v+1]-1],
+// and they are traversed in contiguous memory. A third array, parallel to the
+// targets, stores the index of the attributes of every edge, if any.
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a graph in compressed sparse row format
+  class csr {
+
+  private:
+
+    // INVARIANTS: vertices are identified by the same dense identifiers used
+    // in the parser that created this graph, in the range [0, n). _offsets has
+    // n+1 entries, the last one being the number of edges m, whereas _targets
+    // and _attribute_ids have m entries each. As offsets are stored with 32
+    // bits, m is at most numeric_limits<uint32_t>::max (). The attributes of
+    // the i-th edge are _attributes[_attribute_ids[i]] unless
+    // _attribute_ids[i] is npos
+    vector<uint32_t> _offsets;            // where the edges of every vertex start
+    vector<uint32_t> _targets;                        // targets of all edges
+    vector<uint32_t> _attribute_ids;       // index of the attributes of all edges
+    vector<map<string, string>> _attributes;      // attributes of all edges
+
+    // graphs in CSR format are created by the parser and by snapshots
+    friend class parser;
+    friend class snapshot;
+
+  public:
+
+    // value used for edges with no attributes
+    static constexpr uint32_t npos = numeric_limits<uint32_t>::max ();
+
+    // Default constructor, which creates an empty graph
+    csr ()
+      : _offsets {0}
+    {}
+
+    // get the number of vertices of the graph
+    size_t get_nb_vertices () const
+    { return _offsets.size () - 1; }
+
+    // get the number of edges of the graph
+    size_t get_nb_edges () const
+    { return _targets.size (); }
+
+    // get the offsets where the edges of every vertex start. It has one entry
+    // more than the number of vertices
+    const vector<uint32_t>& get_offsets () const
+    { return _offsets; }
+
+    // get the targets of all edges, sorted by their origin
+    const vector<uint32_t>& get_targets () const
+    { return _targets; }
+
+    // get the index of the attributes of every edge, which is npos if the edge
+    // has no attributes
+    const vector<uint32_t>& get_attribute_ids () const
+    { return _attribute_ids; }
+
+    // get the number of neighbours of the vertex with the given identifier
+    uint32_t get_degree (uint32_t id) const
+    { return _offsets.at (id + 1) - _offsets[id]; }
+
+    // get the attributes of the i-th edge, which are empty if it has none. In
+    // case no edge exists with the given index an exception is raised
+    const map<string, string>& get_edge_attributes (uint32_t edge) const
+    {
+      static const map<string, string> empty;
+      uint32_t index = _attribute_ids.at (edge);
+      return index == npos ? empty : _attributes[index];
+    }
+
+  }; // class csr
+
+} // namespace dot
+
+#endif 	    /* !CSR_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -23,9 +23,15 @@
 // language. For a full description of the dot language, see:
 //
 //    http://www.graphviz.org/doc/info/lang.html
+//
+// They serve as the specification of the tokens of the language. Note however
+// that they are not used by the parser which, instead, relies on the lexer
+// defined in DOTlexer.h which recognizes precisely the same tokens
 
-#include <iostream>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 
 // Specification part
 #define GRAPH_TYPE R"(^[[:space:]]*(digraph|graph))"
@@ -49,18 +55,44 @@ namespace dot {
   
   using namespace std;
 
-  // show a void line if and only if verbose is true
-  static void show_void (const string& line, bool verbose)
+  // return the 64-bit FNV-1a hash of the given data. If a hash is given, the
+  // data is hashed after it, so that many pieces can be hashed in sequence
+  inline uint64_t fnv1a (string_view data, uint64_t hash = 14695981039346656037ull)
   {
-    if (verbose)
-      cout << " [" << line << "]" << endl;
+    for (unsigned char c : data) {
+      hash ^= c;
+      hash *= 1099511628211ull;
+    }
+    return hash;
   }
 
-  // the following is a shortcut for writing data on cout if and only if verbose is true
-  template<class T> void show_value (const string& line, const T& value, bool verbose)
+  // return a 64-bit hash of the given data, which is read in words of 8 bytes
+  // in the byte order of this machine, so that it is much faster than fnv1a
+  // for large data. Words are hashed in four interleaved lanes which are
+  // independent of each other, each one with the FNV-1a step followed by a
+  // xorshift which mixes the upper bits of the product into the lower ones.
+  // The lanes are finally combined along with the size and the trailing bytes
+  inline uint64_t fnv1a_words (string_view data)
   {
-    if (verbose)
-      cout << " [" << line << " " << value << "]" << endl;
+    auto step = [] (uint64_t hash, uint64_t word) {
+      hash = (hash ^ word) * 1099511628211ull;
+      return hash ^ (hash >> 32);
+    };
+
+    uint64_t lanes[4] = {14695981039346656037ull, 14695981039346656037ull ^ 1,
+			 14695981039346656037ull ^ 2, 14695981039346656037ull ^ 3};
+    size_t i = 0;
+    for ( ; i + sizeof lanes <= data.size () ; i += sizeof lanes)
+      for (size_t lane = 0 ; lane < 4 ; lane++) {
+	uint64_t word;
+	memcpy (&word, data.data () + i + lane * sizeof word, sizeof word);
+	lanes[lane] = step (lanes[lane], word);
+      }
+
+    uint64_t hash = step (14695981039346656037ull, data.size ());
+    for (auto lane : lanes)
+      hash = step (hash, lane);
+    return fnv1a (data.substr (i), hash);
   }
 } // namespace dot
 
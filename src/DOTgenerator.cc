@@ -0,0 +1,274 @@
+/*
+  DOTgenerator.cc
+  Description: Generation of large synthetic graphs in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 18:32:06 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+#include "DOTgenerator.h"
+
+namespace {
+
+  // characters of quoted strings and comments
+  const char ALPHABET[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+  // verify that the given probability is in [0, 1] and raise an exception
+  // otherwise
+  void check_probability (double p, const std::string& name)
+  {
+    if (!(p >= 0.0 && p <= 1.0))
+      throw std::invalid_argument ("the " + name + " must be in [0, 1]");
+  }
+
+} // namespace
+
+namespace dot {
+
+  // Explicit constructor. The graph generated has nbvertices vertices and
+  // nbedges edges, and by default it is directed, vertices are uniformly
+  // chosen, there are neither attributes nor comments, and statements are
+  // paths of one edge
+  generator::generator (uint64_t nbvertices, uint64_t nbedges, uint64_t seed)
+    : _nbvertices {nbvertices},
+      _nbedges {nbedges},
+      _seed {seed},
+      _directed {true},
+      _exponent {0.0},
+      _nbvertex_attrs {0},
+      _vertex_density {0.0},
+      _nbedge_attrs {0},
+      _edge_density {0.0},
+      _comment_density {0.0},
+      _block_probability {0.0},
+      _max_block {1},
+      _max_path {1},
+      _state {seed},
+      _zipf_base {0.0}
+  {
+    if (!nbvertices && nbedges)
+      throw invalid_argument ("edges can not be generated without vertices");
+  }
+
+  // draw a random number of 64 bits
+  uint64_t generator::_next ()
+  {
+    uint64_t z = (_state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+  // draw the identifier of a vertex according to the degree distribution. The
+  // Zipf distribution is approximated with the inverse of the cumulative
+  // distribution of its continuous counterpart over [1, n+1). Note that the
+  // results of pow might differ in the last bits between platforms
+  uint64_t generator::_vertex ()
+  {
+    if (_exponent == 0.0)
+      return _below (_nbvertices);
+
+    double x = (_exponent == 1.0)
+      ? pow (double (_nbvertices) + 1, _uniform ())
+      : pow (_zipf_base * _uniform () + 1, 1.0 / (1.0 - _exponent));
+    uint64_t id = uint64_t (x) - 1;
+    return (id < _nbvertices) ? id : _nbvertices - 1;
+  }
+
+  // write a random value: an integer, a floating-point number or a quoted
+  // string
+  void generator::_put_value ()
+  {
+    switch (_below (3)) {
+    case 0:
+      _output.put (_below (1000000));
+      break;
+    case 1: {
+      char digits[32];
+      auto result = to_chars (digits, digits + sizeof digits, _uniform () * 1000,
+			      chars_format::fixed, 3);
+      _output.put (string_view (digits, result.ptr - digits));
+      break;
+    }
+    default:
+      char text[10];
+      text[0] = text[9] = '"';
+      for (auto i = 1 ; i < 9 ; i++)
+	text[i] = ALPHABET[_below (sizeof ALPHABET - 1)];
+      _output.put (string_view (text, sizeof text));
+    }
+  }
+
+  // write a random selection of the attributes with the given prefix, each one
+  // with the given probability, between square brackets (if any)
+  void generator::_put_attributes (char prefix, int nbattrs, double density)
+  {
+    bool first = true;
+    for (auto i = 0 ; i < nbattrs ; i++) {
+      if (!_chance (density))
+	continue;
+      _output.put (first ? " [" : ", ");
+      _output.put (prefix);
+      _output.put (uint64_t (i));
+      _output.put ("=");
+      _put_value ();
+      first = false;
+    }
+    if (!first)
+      _output.put ("]");
+  }
+
+  // write a random comment with the given probability
+  void generator::_put_comment ()
+  {
+    if (!_chance (_comment_density))
+      return;
+    char text[32];
+    for (auto& c : text)
+      c = ALPHABET[_below (sizeof ALPHABET - 1)];
+    _output.put ("\t// ");
+    _output.put (string_view (text, sizeof text));
+    _output.put ("\n");
+  }
+
+  // set the exponent of the power-law distribution of the degrees
+  void generator::set_exponent (double exponent)
+  {
+    if (!(exponent >= 0.0))
+      throw invalid_argument ("the exponent must be non-negative");
+    _exponent = exponent;
+  }
+
+  // set the number of different attributes of vertices and the probability
+  // that every vertex has each one
+  void generator::set_vertex_attributes (int nbattrs, double density)
+  {
+    if (nbattrs < 0)
+      throw invalid_argument ("the number of vertex attributes must be non-negative");
+    check_probability (density, "density of vertex attributes");
+    _nbvertex_attrs = nbattrs;
+    _vertex_density = density;
+  }
+
+  // set the number of different attributes of edges and the probability that
+  // every edge has each one
+  void generator::set_edge_attributes (int nbattrs, double density)
+  {
+    if (nbattrs < 0)
+      throw invalid_argument ("the number of edge attributes must be non-negative");
+    check_probability (density, "density of edge attributes");
+    _nbedge_attrs = nbattrs;
+    _edge_density = density;
+  }
+
+  // set the probability that a comment is written before every statement
+  void generator::set_comments (double density)
+  {
+    check_probability (density, "density of comments");
+    _comment_density = density;
+  }
+
+  // set the probability that a statement is a block of up to maxblock
+  // targets, and the maximum number of edges of the paths written otherwise
+  void generator::set_statements (double block_probability, int maxblock, int maxpath)
+  {
+    check_probability (block_probability, "probability of blocks");
+    if (maxblock < 1 || maxpath < 1)
+      throw invalid_argument ("blocks and paths must have at least one edge");
+    _block_probability = block_probability;
+    _max_block = maxblock;
+    _max_path = maxpath;
+  }
+
+  // write the graph into the given stream and return the number of bytes
+  // written
+  uint64_t generator::generate (ostream& stream)
+  {
+
+    // start all over again, so that the same graph is written every time
+    _state = _seed;
+    _zipf_base = pow (double (_nbvertices) + 1, 1.0 - _exponent) - 1;
+    _output.open (stream);
+    string_view edgeop = _directed ? " ->" : " --";
+
+    _output.put (_directed ? "digraph G {\n" : "graph G {\n");
+
+    // first, declare all vertices with their attributes
+    for (uint64_t id = 0 ; id < _nbvertices ; id++) {
+      _put_comment ();
+      _output.put ("\tv");
+      _output.put (id);
+      _put_attributes ('a', _nbvertex_attrs, _vertex_density);
+      _output.put (";\n");
+    }
+
+    // next, write all edges in paths or blocks
+    uint64_t nbedges = 0;
+    while (nbedges < _nbedges) {
+      _put_comment ();
+      _output.put ("\tv");
+      _output.put (_vertex ());
+
+      uint64_t remaining = _nbedges - nbedges;
+      if (_chance (_block_probability)) {
+
+	// a block of targets, all with the same attributes
+	uint64_t nbtargets = min (remaining, 1 + _below (_max_block));
+	_output.put (edgeop);
+	_put_attributes ('e', _nbedge_attrs, _edge_density);
+	_output.put (" {");
+	for (uint64_t i = 0 ; i < nbtargets ; i++) {
+	  _output.put (" v");
+	  _output.put (_vertex ());
+	}
+	_output.put (" }");
+	nbedges += nbtargets;
+      } else {
+
+	// a path where every edge has its own attributes
+	uint64_t length = min (remaining, 1 + _below (_max_path));
+	for (uint64_t i = 0 ; i < length ; i++) {
+	  _output.put (edgeop);
+	  _put_attributes ('e', _nbedge_attrs, _edge_density);
+	  _output.put (" v");
+	  _output.put (_vertex ());
+	}
+	nbedges += length;
+      }
+      _output.put (";\n");
+    }
+    _output.put ("}\n");
+
+    // and write the output pending
+    uint64_t nbbytes = _output.close ();
+    if (!stream)
+      throw invalid_argument ("the graph could not be written");
+    return nbbytes;
+  }
+
+  // write the graph into the given file and return the number of bytes
+  // written
+  uint64_t generator::generate (const string& filename)
+  {
+    ofstream stream (filename, ios::binary);
+    if (!stream)
+      throw invalid_argument ("the file '" + filename + "' could not be created");
+    return generate (stream);
+  }
+
+} // namespace dot
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
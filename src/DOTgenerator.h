@@ -0,0 +1,172 @@
+/*
+  DOTgenerator.h
+  Description: Generation of large synthetic graphs in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 18:32:06 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	GENERATOR_H_
+# define   	GENERATOR_H_
+
+// Synthetic graphs of arbitrary size are streamed in the DOT language, so that
+// they are never stored in memory. First, every vertex is declared in a node
+// statement, and then edges are written either in paths or in blocks of
+// multiple targets. The origins and targets of edges are drawn from a power-law
+// (Zipf) distribution, so that vertices with the lowest identifiers become
+// hubs, or from a uniform distribution if the exponent is zero. Vertices, edges
+// and comments are randomly decorated with the given densities. The same
+// output is generated for the same seed, since all random numbers are drawn
+// with a generator implemented here. Power-law distributions are drawn with
+// std::pow, whose results are not required to be the same in different
+// implementations of the standard library, so that only graphs whose vertices
+// are uniformly chosen are known to be the same in every platform.
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "DOToutput.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a generator of synthetic graphs
+  class generator {
+
+  private:
+
+    // INVARIANTS: the graph has precisely _nbvertices vertices named v0,
+    // v1, ... and _nbedges edges, some of which might be duplicated. Every
+    // vertex (edge) has each of the attributes a0, a1, ... (e0, e1, ...)
+    // with probability _vertex_density (_edge_density). Every statement
+    // writes a block of multiple targets with probability
+    // _block_probability, and a path otherwise, with up to _max_block targets
+    // or _max_path edges
+    uint64_t _nbvertices;                                 // number of vertices
+    uint64_t _nbedges;                                       // number of edges
+    uint64_t _seed;                            // seed of the random numbers
+    bool _directed;                             // whether the graph is directed
+    double _exponent;               // exponent of the power-law distribution
+    int _nbvertex_attrs;               // number of different vertex attributes
+    double _vertex_density;             // probability of every vertex attribute
+    int _nbedge_attrs;                   // number of different edge attributes
+    double _edge_density;                 // probability of every edge attribute
+    double _comment_density;        // probability of a comment per statement
+    double _block_probability;          // probability of a block per statement
+    int _max_block;                          // maximum number of targets per block
+    int _max_path;                              // maximum number of edges per path
+
+    // INVARIANTS: random numbers are drawn from the state of a splitmix64
+    // generator, and the output is written with a buffer which is allocated
+    // only once
+    uint64_t _state;                           // state of the random numbers
+    double _zipf_base;             // n^(1-s) - 1 for drawing vertices quickly
+    output _output;                                     // output being written
+
+    // draw a random number of 64 bits
+    uint64_t _next ();
+
+    // draw a random number uniformly distributed in [0, 1)
+    double _uniform ()
+    { return (_next () >> 11) * 0x1.0p-53; }
+
+    // draw a random number uniformly distributed in [0, n)
+    uint64_t _below (uint64_t n)
+    { return n ? _next () % n : 0; }
+
+    // return true with the given probability
+    bool _chance (double p)
+    { return _uniform () < p; }
+
+    // draw the identifier of a vertex according to the degree distribution
+    uint64_t _vertex ();
+
+    // write a random value: an integer, a floating-point number or a quoted
+    // string
+    void _put_value ();
+
+    // write a random selection of the attributes with the given prefix, each
+    // one with the given probability, between square brackets (if any)
+    void _put_attributes (char prefix, int nbattrs, double density);
+
+    // write a random comment with the given probability
+    void _put_comment ();
+
+  public:
+
+    // Explicit constructor. The graph generated has nbvertices vertices and
+    // nbedges edges, and by default it is directed, vertices are uniformly
+    // chosen, there are neither attributes nor comments, and statements are
+    // paths of one edge
+    generator (uint64_t nbvertices, uint64_t nbedges, uint64_t seed = 0);
+
+    // get accessors
+    uint64_t get_nb_vertices () const
+    { return _nbvertices; }
+    uint64_t get_nb_edges () const
+    { return _nbedges; }
+    uint64_t get_seed () const
+    { return _seed; }
+    bool get_directed () const
+    { return _directed; }
+    double get_exponent () const
+    { return _exponent; }
+
+    // set whether the graph is directed or undirected
+    void set_directed (bool directed = true)
+    { _directed = directed; }
+
+    // set the exponent of the power-law distribution of the degrees, so that
+    // the probability of choosing the i-th vertex is proportional to
+    // (i+1)^(-exponent). If it is zero, vertices are uniformly chosen. In case
+    // it is negative an exception is raised
+    void set_exponent (double exponent);
+
+    // set the number of different attributes of vertices and the probability
+    // that every vertex has each one. In case the number is negative or the
+    // probability is not in [0, 1] an exception is raised
+    void set_vertex_attributes (int nbattrs, double density);
+
+    // set the number of different attributes of edges and the probability
+    // that every edge has each one. In case the number is negative or the
+    // probability is not in [0, 1] an exception is raised
+    void set_edge_attributes (int nbattrs, double density);
+
+    // set the probability that a comment is written before every
+    // statement. In case it is not in [0, 1] an exception is raised
+    void set_comments (double density);
+
+    // set the probability that a statement is a block of up to maxblock
+    // targets, and the maximum number of edges of the paths written
+    // otherwise. In case the probability is not in [0, 1] or either maximum
+    // is less than one an exception is raised
+    void set_statements (double block_probability, int maxblock, int maxpath);
+
+    // write the graph into the given stream and return the number of bytes
+    // written. The same graph is written every time
+    uint64_t generate (ostream& stream);
+
+    // write the graph into the given file and return the number of bytes
+    // written. In case the file can not be written an exception is raised
+    uint64_t generate (const string& filename);
+
+  }; // class generator
+
+} // namespace dot
+
+#endif 	    /* !GENERATOR_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
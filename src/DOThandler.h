@@ -0,0 +1,68 @@
+/*
+  DOThandler.h
+  Description: Handlers of the notifications issued by the reader
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 09:02:31 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	HANDLER_H_
+# define   	HANDLER_H_
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dot {
+
+  using namespace std;
+
+  // attributes of vertices and edges are notified as a sequence of pairs
+  // (name, value) in the same order they are given. Note that the same name
+  // might then appear more than once
+  using attributes = vector<pair<string_view, string_view>>;
+
+  // Struct definition
+  //
+  // Definition of a handler which ignores all notifications. Handlers can
+  // derive from it to process only those notifications they are interested
+  // in. All names and values given are views over the contents being read
+  // (with the double quotes removed, if any) and they are valid only during the
+  // notification
+  struct handler {
+
+    // the header of a graph with its type (either "graph" or "digraph") and
+    // name (which can be the empty string)
+    void graph (string_view /*type*/, string_view /*name*/) {}
+
+    // a label with its value
+    void label (string_view /*name*/, string_view /*value*/) {}
+
+    // a node statement, i.e., a vertex which is declared on its own
+    void vertex (string_view /*name*/) {}
+
+    // the attributes of a vertex
+    void vertex_attributes (string_view /*name*/, const attributes& /*attrs*/) {}
+
+    // an edge from orig to target, either directed (->) or undirected (--)
+    void edge (string_view /*orig*/, string_view /*target*/, bool /*directed*/) {}
+
+    // the attributes of the edge from orig to target. They are notified right
+    // after the edge only if any are given
+    void edge_attributes (string_view /*orig*/, string_view /*target*/, bool /*directed*/,
+			  const attributes& /*attrs*/) {}
+  }; // struct handler
+
+} // namespace dot
+
+#endif 	    /* !HANDLER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
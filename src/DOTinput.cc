@@ -0,0 +1,136 @@
+/*
+  DOTinput.cc
+  Description: Read-only access to the contents of dot files
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 14:02:41 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <cerrno>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DOTinput.h"
+
+// Private services
+// ----------------------------------------------------------------------------
+
+// read the whole contents of the given file descriptor into the buffer. It
+// returns true if the operation was successfully performed and false otherwise
+bool dot::input::_read (int fd)
+{
+  const size_t chunk = 1 << 16;
+  _buffer.clear ();
+  for (;;) {
+    size_t size = _buffer.size ();
+    _buffer.resize (size + chunk);
+    ssize_t nbytes = ::read (fd, &_buffer[size], chunk);
+
+    // retry if interrupted, and stop at the end of file or after an error
+    if (nbytes < 0 && errno == EINTR)
+      nbytes = 0;
+    else if (nbytes < 0) {
+      _buffer.clear ();
+      return false;
+    } else if (!nbytes) {
+      _buffer.resize (size);
+      break;
+    }
+    _buffer.resize (size + nbytes);
+  }
+  _data = _buffer.data ();
+  _size = _buffer.size ();
+  _mapped = false;
+  return true;
+}
+
+// Public services
+// ----------------------------------------------------------------------------
+
+// move constructor and assignment
+dot::input::input (input&& other)
+  : input ()
+{
+  *this = std::move (other);
+}
+
+dot::input& dot::input::operator= (input&& other)
+{
+  if (this != &other) {
+    close ();
+    _mapped = other._mapped;
+    _size = other._size;
+    _buffer = std::move (other._buffer);
+    _data = _mapped ? other._data : _buffer.data ();
+
+    // the other input does not own the contents anymore
+    other._data = nullptr;
+    other._size = 0;
+    other._mapped = false;
+    other._buffer.clear ();
+  }
+  return *this;
+}
+
+// open the given file and make its contents available. It returns true if the
+// operation was successfully performed and false otherwise
+bool dot::input::open (const string& filename)
+{
+  close ();
+  int fd = ::open (filename.c_str (), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  // regular files are mapped into memory. Note that empty files can not be
+  // mapped, but they have no contents anyway
+  struct stat status;
+  bool success = false;
+  if (fstat (fd, &status) == 0 && S_ISREG (status.st_mode)) {
+    if (!status.st_size) {
+      _data = "";
+      success = true;
+    } else {
+      void* addr = mmap (nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+	madvise (addr, status.st_size, MADV_SEQUENTIAL);
+	_data = static_cast<const char*> (addr);
+	_size = status.st_size;
+	_mapped = success = true;
+      }
+    }
+  }
+
+  // any other file, or those that could not be mapped, are read into the
+  // buffer
+  if (!success)
+    success = _read (fd);
+
+  ::close (fd);
+  return success;
+}
+
+// release the contents of this input
+void dot::input::close ()
+{
+  if (_mapped)
+    munmap (const_cast<char*> (_data), _size);
+  _data = nullptr;
+  _size = 0;
+  _mapped = false;
+  _buffer.clear ();
+  _buffer.shrink_to_fit ();
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,91 @@
+/*
+  DOTinput.h
+  Description: Read-only access to the contents of dot files
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 14:02:41 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	INPUT_H_
+# define   	INPUT_H_
+
+// Regular files are mapped into memory so that they are parsed directly from
+// the page cache without copying them, and the kernel is advised that they are
+// read sequentially. Any other file (e.g., pipes or character devices) or
+// those that can not be mapped are read into an internal buffer instead.
+
+#include <string>
+#include <string_view>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of the input of a dot file. Inputs own the mapping (or the
+  // buffer) of their contents, so that they can be moved but not copied
+  class input {
+
+  private:
+
+    // INVARIANTS: the contents are given by _data and _size. If _mapped is
+    // true they are a private read-only mapping of the file which is released
+    // when the input is closed; otherwise they point to _buffer
+    const char* _data;                      // first character of the contents
+    size_t _size;                                // size of the contents
+    bool _mapped;                        // whether the contents are mapped
+    string _buffer;          // contents of files which are not mapped
+
+    // read the whole contents of the given file descriptor into the buffer. It
+    // returns true if the operation was successfully performed and false
+    // otherwise
+    bool _read (int fd);
+
+  public:
+
+    // Default constructor
+    input ()
+      : _data {nullptr},
+	_size {0},
+	_mapped {false}
+    {}
+
+    // inputs can be moved but not copied
+    input (const input&) = delete;
+    input& operator= (const input&) = delete;
+    input (input&& other);
+    input& operator= (input&& other);
+
+    // Destructor
+    ~input ()
+    { close (); }
+
+    // open the given file and make its contents available. It returns true if
+    // the operation was successfully performed and false otherwise
+    bool open (const string& filename);
+
+    // release the contents of this input
+    void close ();
+
+    // get accessors
+    string_view get_contents () const
+    { return string_view (_data, _size); }
+    bool is_mapped () const
+    { return _mapped; }
+
+  }; // class input
+
+} // namespace dot
+
+#endif 	    /* !INPUT_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
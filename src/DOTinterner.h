@@ -0,0 +1,147 @@
+/*
+  DOTinterner.h
+  Description: Symbol table of vertex names
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 19:05:48 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	INTERNER_H_
+# define   	INTERNER_H_
+
+// The interner assigns a dense identifier to every distinct name, in the same
+// order they are interned: the first name gets the identifier 0, the second
+// one 1, and so on. Thus, identifiers can be used to index vectors, and names
+// are compared only once, when they are interned. All memory is taken from the
+// memory resource given in the constructor.
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a symbol table of names
+  class interner {
+
+  private:
+
+    // INVARIANTS: _names stores the name of every identifier, and _ids the
+    // identifier of every name. Note that the keys of _ids are views over the
+    // names stored in _names, which are never relocated (as elements of a
+    // deque are not moved when new ones are appended)
+    pmr::deque<pmr::string> _names;             // name of every identifier
+    pmr::unordered_map<string_view, uint32_t> _ids;  // identifier of every name
+
+    // rebuild the identifiers of all names, which are views over _names
+    void _rebuild ()
+    {
+      _ids.clear ();
+      _ids.reserve (_names.size ());
+      for (uint32_t id = 0 ; id < _names.size () ; id++)
+	_ids.emplace (_names[id], id);
+    }
+
+  public:
+
+    // value returned when a name is not found
+    static constexpr uint32_t npos = numeric_limits<uint32_t>::max ();
+
+    // Default constructor, which takes all memory from the given resource
+    explicit interner (pmr::memory_resource* resource = pmr::get_default_resource ())
+      : _names {resource},
+	_ids {resource}
+    {}
+
+    // interners can be copied and moved. Because the identifiers of the names
+    // are views over _names, they are rebuilt whenever names might be
+    // relocated, i.e., in all cases but move construction. Copies take their
+    // memory from the default resource, whereas assignments preserve the
+    // resource of this interner
+    interner (const interner& other)
+      : _names {other._names}
+    { _rebuild (); }
+    interner (interner&&) = default;
+    interner& operator= (const interner& other)
+    {
+      if (this != &other) {
+	_names = other._names;
+	_rebuild ();
+      }
+      return *this;
+    }
+    interner& operator= (interner&& other)
+    {
+      if (this != &other) {
+	_names = std::move (other._names);
+	_rebuild ();
+	other.clear ();
+      }
+      return *this;
+    }
+
+    // return the identifier of the given name, which is interned if it was not
+    // found
+    uint32_t intern (string_view name)
+    {
+      auto iname = _ids.find (name);
+      if (iname != _ids.end ())
+	return iname->second;
+      uint32_t id = _names.size ();
+      _names.emplace_back (name);
+      _ids.emplace (_names.back (), id);
+      return id;
+    }
+
+    // return the identifier of the given name, or npos if it was never
+    // interned
+    uint32_t find (string_view name) const
+    {
+      auto iname = _ids.find (name);
+      return iname == _ids.end () ? npos : iname->second;
+    }
+
+    // return the name with the given identifier. If it does not exist, an
+    // exception is raised
+    string_view get_name (uint32_t id) const
+    {
+      if (id >= _names.size ())
+	throw out_of_range ("no name has the identifier " + to_string (id));
+      return _names[id];
+    }
+
+    // return the number of names interned
+    size_t size () const
+    { return _names.size (); }
+
+    // remove all names
+    void clear ()
+    {
+      _ids.clear ();
+      _names.clear ();
+    }
+
+  }; // class interner
+
+} // namespace dot
+
+#endif 	    /* !INTERNER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
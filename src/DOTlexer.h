@@ -0,0 +1,519 @@
+/*
+  DOTlexer.h
+  Description: Compile-time lexer for the tokens of the dot language
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 09:12:40 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	LEXER_H_
+# define   	LEXER_H_
+
+// The lexer recognizes precisely the same tokens than the regexps defined in
+// DOTdefs.h, with the same semantics (including the preferences among
+// alternatives and the backtracking of the ECMAScript grammar). However, no
+// regexp is ever compiled nor executed. Instead, every token is recognized
+// with a dedicated matcher which is selected at compile time (by specializing
+// a template over the token kind) and which only consults a table of character
+// classes which is also computed at compile time. At run time, the longest
+// scans are delegated to the vectorized kernels of the scanner.
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "DOTscan.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Enum definition
+  //
+  // kinds of tokens acknowledged by the lexer. There is one per regexp defined
+  // in DOTdefs.h and they are named after them
+  enum class token : unsigned char {
+    graph_type,                                                   // GRAPH_TYPE
+    graph_name,                                                   // GRAPH_NAME
+    block_begin,                                                 // BLOCK_BEGIN
+    block_end,                                                     // BLOCK_END
+    label_assignment,                                       // LABEL_ASSIGNMENT
+    label_value,                                                 // LABEL_VALUE
+    vertex_name,                                                 // VERTEX_NAME
+    edge_type,                                                     // EDGE_TYPE
+    end_of_statement,                                       // END_OF_STATEMENT
+    cpp_comment,                                                 // CPP_COMMENT
+    attribute_begin,                                         // ATTRIBUTE_BEGIN
+    attribute_name,                                           // ATTRIBUTE_NAME
+    attribute_value_next,                               // ATTRIBUTE_VALUE_NEXT
+    attribute_value_end,                                 // ATTRIBUTE_VALUE_END
+    attribute_end                                              // ATTRIBUTE_END
+  };
+
+  // number of different kinds of tokens
+  constexpr size_t nbtokens = 15;
+
+  // Class definition
+  //
+  // Definition of the lexer. It consists only of static services which are all
+  // evaluable at compile time
+  class lexer {
+
+  public:
+
+    // the following value is returned by the matchers when the token is not
+    // found at the beginning of the text
+    static constexpr size_t npos = string_view::npos;
+
+    // return the number of characters at the beginning of text that match the
+    // token T and npos if it does not match. In case of success, value is set
+    // to the first group of the corresponding regexp in DOTdefs.h (if any) as
+    // a view over text. Otherwise, it is left untouched
+    template<token T>
+    static constexpr size_t match (string_view text, string_view& value);
+
+    // return true if the token T might match the given text once more text is
+    // appended to it, i.e., if the text consists only of blanks or the match
+    // needs to read past its end. It is meant for text which ends with a line
+    // terminator, so that only those tokens that can span several lines are
+    // given the text after their blanks
+    template<token T>
+    static constexpr bool is_prefix (string_view text)
+    { return _spaces (text.data (), text.data () + text.size ()) == text.data () + text.size (); }
+
+    // return true if the given text can be given with no double quotes as the
+    // value of an attribute, i.e., if it is entirely matched by either the
+    // number or the identifier of ATTRIBUTE_VALUE_NEXT and ATTRIBUTE_VALUE_END
+    static constexpr bool is_attribute_value (string_view text)
+    {
+      const char* end = text.data () + text.size ();
+      return !text.empty () &&
+	(_number (text.data (), end) == end || _identifier (text.data (), end) == end);
+    }
+
+    // return true if the given text can be given with no double quotes as the
+    // value of a label, i.e., if the first alternative of LABEL_VALUE that
+    // matches it, either a number or an identifier, matches it entirely
+    static constexpr bool is_label_value (string_view text)
+    {
+      const char* end = text.data () + text.size ();
+      if (const char* q = _number (text.data (), end))
+	return q == end;
+      return text.size () > 1 && _is (text[0], _alpha) &&
+	_identifier (text.data () + 1, end) == end;
+    }
+
+  private:
+
+    // character classes are represented as flags of a single byte
+    static constexpr unsigned char _space = 1;                 // [[:space:]]
+    static constexpr unsigned char _digit = 2;                 // \d
+    static constexpr unsigned char _alpha = 4;                 // [a-zA-Z_]
+    static constexpr unsigned char _ident = _digit | _alpha;   // [0-9a-zA-Z_]
+
+    // table of character classes of all characters
+    static constexpr array<unsigned char, 256> _classes = [] () {
+      array<unsigned char, 256> classes {};
+      for (int c = 0 ; c < 256 ; c++) {
+	if (c == ' ' || (c >= '\t' && c <= '\r'))
+	  classes[c] |= _space;
+	if (c >= '0' && c <= '9')
+	  classes[c] |= _digit;
+	if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')
+	  classes[c] |= _alpha;
+      }
+      return classes;
+    } ();
+
+    // return whether the given character belongs to the given class
+    static constexpr bool _is (char c, unsigned char cls)
+    { return _classes[static_cast<unsigned char>(c)] & cls; }
+
+    // return whether the lexer is being evaluated at compile time. In that
+    // case, the scanner can not be used as it is not constexpr. If this can not
+    // be determined, then the scanner is never used
+    static constexpr bool _at_compile_time ()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      return __builtin_is_constant_evaluated ();
+#else
+      return true;
+#endif
+    }
+
+    // the following services consume characters from p up to (but not
+    // including) end, and return a pointer to the first character that was not
+    // consumed or nullptr if they failed
+
+    // [[:space:]]*
+    static constexpr const char* _spaces (const char* p, const char* end)
+    {
+      if (!_at_compile_time ())
+	return scanner::spaces (p, end);
+      while (p != end && _is (*p, _space))
+	p++;
+      return p;
+    }
+
+    // [0-9a-zA-Z_]*
+    static constexpr const char* _identifier (const char* p, const char* end)
+    {
+      if (!_at_compile_time ())
+	return scanner::identifier (p, end);
+      while (p != end && _is (*p, _ident))
+	p++;
+      return p;
+    }
+
+    // \d*
+    static constexpr const char* _digits (const char* p, const char* end)
+    {
+      while (p != end && _is (*p, _digit))
+	p++;
+      return p;
+    }
+
+    // the given keyword
+    static constexpr const char* _keyword (const char* p, const char* end,
+					   string_view keyword)
+    {
+      for (auto c : keyword) {
+	if (p == end || *p != c)
+	  return nullptr;
+	p++;
+      }
+      return p;
+    }
+
+    // [-+]?(\d+\.?\d*|\d*\.?\d+)([Ee][-+]?[0-2]?\d{1,2})?
+    //
+    // The greedy match is returned. Note that any other match of the regexp
+    // is a prefix of this one which is followed by a character of the number
+    // itself, so that no backtracking is ever needed when a number is
+    // followed by other tokens
+    static constexpr const char* _number (const char* p, const char* end)
+    {
+      if (p != end && (*p == '-' || *p == '+'))
+	p++;
+      const char* q = _digits (p, end);
+      if (q != p) {                                             // \d+\.?\d*
+	if (q != end && *q == '.')
+	  q = _digits (q + 1, end);
+      }
+      else {                                                 // \.\d+
+	if (p == end || *p != '.' || (q = _digits (p + 1, end)) == p + 1)
+	  return nullptr;
+      }
+
+      // and now the exponent, if any is given
+      if (q != end && (*q == 'e' || *q == 'E')) {
+	const char* r = q + 1;
+	if (r != end && (*r == '-' || *r == '+'))
+	  r++;
+
+	// [0-2]? is greedy but it is given up if no digit follows
+	if (r != end && *r >= '0' && *r <= '2') {
+	  const char* s = _up_to_two_digits (r + 1, end);
+	  if (s != r + 1)
+	    return s;
+	}
+	const char* s = _up_to_two_digits (r, end);
+	if (s != r)
+	  return s;
+      }
+      return q;
+    }
+
+    // \d{0,2}
+    static constexpr const char* _up_to_two_digits (const char* p, const char* end)
+    {
+      for (int i = 0 ; i < 2 && p != end && _is (*p, _digit) ; i++, p++);
+      return p;
+    }
+
+    // (\"[^\"]*\")+
+    static constexpr const char* _quoted_strings (const char* p, const char* end)
+    {
+      const char* q = nullptr;
+      while (p != end && *p == '"') {
+	const char* r = p + 1;
+	if (!_at_compile_time ())
+	  r = scanner::quote (r, end);
+	else
+	  while (r != end && *r != '"')
+	    r++;
+	if (r == end)
+	  break;
+	q = p = r + 1;
+      }
+      return q;
+    }
+
+    // (\".*")+ where . matches anything but line terminators, i.e., the text
+    // between the first double quote and the last one in the same line
+    static constexpr const char* _quoted_line (const char* p, const char* end)
+    {
+      if (p == end || *p != '"')
+	return nullptr;
+      const char* q = nullptr;
+      for (const char* r = p + 1 ; r != end && *r != '\n' && *r != '\r' ; r++)
+	if (*r == '"')
+	  q = r + 1;
+      return q;
+    }
+
+    // return the length of the match from begin to p, or npos if p is null
+    static constexpr size_t _length (const char* begin, const char* p)
+    { return p ? size_t (p - begin) : npos; }
+
+    // return true if [[:space:]]*(([0-9a-zA-Z_]+))[[:space:]]* consumes the
+    // whole text, so that the assignment might be completed later
+    static constexpr bool _is_assignment_prefix (string_view text)
+    {
+      const char* end = text.data () + text.size ();
+      const char* p = _spaces (text.data (), end);
+      return _spaces (_identifier (p, end), end) == end;
+    }
+
+    // return true if the value of an attribute given at the beginning of the
+    // text might be completed later, i.e., if the characters of numbers and
+    // identifiers followed by blanks consume the whole text (as numbers might
+    // be incomplete, e.g., "1." or "1e+"), or a quoted string is not closed
+    static constexpr bool _is_attribute_value_prefix (string_view text)
+    {
+      const char* end = text.data () + text.size ();
+      const char* p = _spaces (text.data (), end);
+      if (p == end)
+	return true;
+      const char* q = p;
+      while (q != end && (_is (*q, _ident) || *q == '.' || *q == '+' || *q == '-'))
+	q++;
+      if (q != p && _spaces (q, end) == end)
+	return true;
+      if (*p != '"')
+	return false;
+
+      // quoted strings are not closed if the first one, or the one following
+      // the last closed, reaches the end of the text
+      q = _quoted_strings (p, end);
+      return !q || _spaces (q, end) == end || *q == '"';
+    }
+
+    // [[:space:]]*(single)
+    static constexpr size_t _single (string_view text, char c)
+    {
+      const char* p = _spaces (text.data (), text.data () + text.size ());
+      return (p != text.data () + text.size () && *p == c)
+	? size_t (p + 1 - text.data ())
+	: npos;
+    }
+
+    // [[:space:]]*(([0-9a-zA-Z_]+))[[:space:]]*=
+    static constexpr size_t _assignment (string_view text, string_view& value)
+    {
+      const char* end = text.data () + text.size ();
+      const char* p = _spaces (text.data (), end);
+      const char* q = _identifier (p, end);
+      if (q == p)
+	return npos;
+      const char* r = _spaces (q, end);
+      if (r == end || *r != '=')
+	return npos;
+      value = string_view (p, q - p);
+      return r + 1 - text.data ();
+    }
+
+    // [[:space:]]*((number|([0-9a-zA-Z_]+)|(\"[^\"]*\")+))[[:space:]]*(delim)
+    //
+    // Alternatives are tried in order as the ECMAScript grammar does and the
+    // first one that is followed by the delimiter is taken
+    static constexpr size_t _attribute_value (string_view text, string_view& value,
+					      char delim)
+    {
+      const char* end = text.data () + text.size ();
+      const char* p = _spaces (text.data (), end);
+      const char* candidates[] = {_number (p, end),
+				  _identifier (p, end),
+				  _quoted_strings (p, end)};
+      for (auto q : candidates) {
+	if (!q || q == p)
+	  continue;
+	const char* r = _spaces (q, end);
+	if (r != end && *r == delim) {
+	  value = string_view (p, q - p);
+	  return r + 1 - text.data ();
+	}
+      }
+      return npos;
+    }
+
+  }; // class lexer
+
+  // Matchers
+  // --------------------------------------------------------------------------
+
+  // GRAPH_TYPE: [[:space:]]*(digraph|graph)
+  template<>
+  constexpr size_t lexer::match<token::graph_type> (string_view text, string_view& value)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _spaces (text.data (), end);
+    const char* q = _keyword (p, end, "digraph");
+    if (!q)
+      q = _keyword (p, end, "graph");
+    if (q)
+      value = string_view (p, q - p);
+    return _length (text.data (), q);
+  }
+
+  // GRAPH_NAME: [[:space:]]*([0-9a-zA-Z_]*) ---it always matches
+  template<>
+  constexpr size_t lexer::match<token::graph_name> (string_view text, string_view& value)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _spaces (text.data (), end);
+    const char* q = _identifier (p, end);
+    value = string_view (p, q - p);
+    return q - text.data ();
+  }
+
+  // BLOCK_BEGIN: [[:space:]]*\{
+  template<>
+  constexpr size_t lexer::match<token::block_begin> (string_view text, string_view&)
+  { return _single (text, '{'); }
+
+  // BLOCK_END: [[:space:]]*}
+  template<>
+  constexpr size_t lexer::match<token::block_end> (string_view text, string_view&)
+  { return _single (text, '}'); }
+
+  // LABEL_ASSIGNMENT: [[:space:]]*(([0-9a-zA-Z_]+))[[:space:]]*=
+  template<>
+  constexpr size_t lexer::match<token::label_assignment> (string_view text, string_view& value)
+  { return _assignment (text, value); }
+
+  // LABEL_VALUE:
+  // [[:space:]]*((number|([a-zA-Z_][0-9a-zA-Z_]+)|(\".*")+))[[:space:]]*
+  //
+  // because the trailing spaces always match, the first alternative that
+  // matches is taken
+  template<>
+  constexpr size_t lexer::match<token::label_value> (string_view text, string_view& value)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _spaces (text.data (), end);
+    const char* q = _number (p, end);
+    if (!q && p != end && _is (*p, _alpha)) {
+      q = _identifier (p + 1, end);
+      if (q == p + 1)
+	q = nullptr;
+    }
+    if (!q)
+      q = _quoted_line (p, end);
+    if (!q)
+      return npos;
+    value = string_view (p, q - p);
+    return _spaces (q, end) - text.data ();
+  }
+
+  // VERTEX_NAME: [[:space:]]*([0-9a-zA-Z_]+)
+  template<>
+  constexpr size_t lexer::match<token::vertex_name> (string_view text, string_view& value)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _spaces (text.data (), end);
+    const char* q = _identifier (p, end);
+    if (q == p)
+      return npos;
+    value = string_view (p, q - p);
+    return q - text.data ();
+  }
+
+  // EDGE_TYPE: [[:space:]]*(--|->)
+  template<>
+  constexpr size_t lexer::match<token::edge_type> (string_view text, string_view& value)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _spaces (text.data (), end);
+    if (end - p < 2 || p[0] != '-' || (p[1] != '-' && p[1] != '>'))
+      return npos;
+    value = string_view (p, 2);
+    return p + 2 - text.data ();
+  }
+
+  // END_OF_STATEMENT: [[:space:]]*;
+  template<>
+  constexpr size_t lexer::match<token::end_of_statement> (string_view text, string_view&)
+  { return _single (text, ';'); }
+
+  // CPP_COMMENT: [[:space:]]*//.*\n
+  //
+  // Note that . does not match line terminators, so that comments must be
+  // ended with a newline which is not preceded by a carriage return
+  template<>
+  constexpr size_t lexer::match<token::cpp_comment> (string_view text, string_view&)
+  {
+    const char* end = text.data () + text.size ();
+    const char* p = _keyword (_spaces (text.data (), end), end, "//");
+    if (!p)
+      return npos;
+    while (p != end && *p != '\n' && *p != '\r')
+      p++;
+    return (p != end && *p == '\n') ? size_t (p + 1 - text.data ()) : npos;
+  }
+
+  // ATTRIBUTE_BEGIN: [[:space:]]*\[
+  template<>
+  constexpr size_t lexer::match<token::attribute_begin> (string_view text, string_view&)
+  { return _single (text, '['); }
+
+  // ATTRIBUTE_NAME: [[:space:]]*(([0-9a-zA-Z_]+))[[:space:]]*=
+  template<>
+  constexpr size_t lexer::match<token::attribute_name> (string_view text, string_view& value)
+  { return _assignment (text, value); }
+
+  // ATTRIBUTE_VALUE_NEXT:
+  // [[:space:]]*((number|([0-9a-zA-Z_]+)|(\"[^\"]*\")+))[[:space:]]*,
+  template<>
+  constexpr size_t lexer::match<token::attribute_value_next> (string_view text, string_view& value)
+  { return _attribute_value (text, value, ','); }
+
+  // ATTRIBUTE_VALUE_END:
+  // [[:space:]]*((number|([0-9a-zA-Z_]+)|(\"[^\"]*\")+))[[:space:]]*\]
+  template<>
+  constexpr size_t lexer::match<token::attribute_value_end> (string_view text, string_view& value)
+  { return _attribute_value (text, value, ']'); }
+
+  // the assignments of labels and attributes, and the values of attributes,
+  // might be completed in the following lines
+  template<>
+  constexpr bool lexer::is_prefix<token::label_assignment> (string_view text)
+  { return _is_assignment_prefix (text); }
+  template<>
+  constexpr bool lexer::is_prefix<token::attribute_name> (string_view text)
+  { return _is_assignment_prefix (text); }
+  template<>
+  constexpr bool lexer::is_prefix<token::attribute_value_next> (string_view text)
+  { return _is_attribute_value_prefix (text); }
+  template<>
+  constexpr bool lexer::is_prefix<token::attribute_value_end> (string_view text)
+  { return _is_attribute_value_prefix (text); }
+
+  // ATTRIBUTE_END: [[:space:]]*\]
+  template<>
+  constexpr size_t lexer::match<token::attribute_end> (string_view text, string_view&)
+  { return _single (text, ']'); }
+
+} // namespace dot
+
+#endif 	    /* !LEXER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,87 @@
+/*
+  DOToutput.cc
+  Description: Buffered output of contents in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sun Oct 18 00:27:14 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <charconv>
+#include <cstring>
+
+#include "DOToutput.h"
+
+namespace {
+
+  // the output is written into the stream in chunks of this size
+  const size_t CHUNK_SIZE = 1 << 20;
+
+} // namespace
+
+// Private services
+// ----------------------------------------------------------------------------
+
+// write the output pending into the stream
+void dot::output::_flush ()
+{
+  _stream->write (_buffer.data (), _position);
+  _nbbytes += _position;
+  _position = 0;
+}
+
+// Public services
+// ----------------------------------------------------------------------------
+
+// start writing into the given stream, with no bytes written yet
+void dot::output::open (ostream& stream)
+{
+
+  // the buffer is allocated only the first time
+  _buffer.resize (CHUNK_SIZE);
+  _position = 0;
+  _stream = &stream;
+  _nbbytes = 0;
+}
+
+// write the output pending into the stream, and return the number of bytes
+// written since it was opened
+uint64_t dot::output::close ()
+{
+  _flush ();
+  _stream = nullptr;
+  return _nbbytes;
+}
+
+// write the given text into the output. Texts larger than the buffer are
+// written directly into the stream
+void dot::output::put (string_view text)
+{
+  if (_position + text.size () > _buffer.size ())
+    _flush ();
+  if (text.size () > _buffer.size ()) {
+    _stream->write (text.data (), text.size ());
+    _nbbytes += text.size ();
+    return;
+  }
+  memcpy (&_buffer[_position], text.data (), text.size ());
+  _position += text.size ();
+}
+
+// write the given number into the output, directly into the buffer
+void dot::output::put (uint64_t number)
+{
+  if (_position + 20 > _buffer.size ())
+    _flush ();
+  auto result = to_chars (&_buffer[_position], _buffer.data () + _buffer.size (), number);
+  _position = result.ptr - _buffer.data ();
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
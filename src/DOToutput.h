@@ -0,0 +1,84 @@
+/*
+  DOToutput.h
+  Description: Buffered output of contents in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sun Oct 18 00:27:14 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	OUTPUT_H_
+# define   	OUTPUT_H_
+
+// Contents written in the DOT language (either graphs held by a parser or
+// synthetic graphs) are written into a large buffer which is flushed to the
+// stream whenever it is full, so that nothing is allocated per vertex or
+// edge. The buffer is allocated only once, and reused every time the output is
+// opened again.
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a buffered output
+  class output {
+
+  private:
+
+    // INVARIANTS: the output is written in the first _position characters of
+    // _buffer, which are flushed to the stream whenever it is full
+    string _buffer;                                       // pending output
+    size_t _position;                      // number of characters pending
+    ostream* _stream;                             // stream being written
+    uint64_t _nbbytes;                          // number of bytes written
+
+    // write the output pending into the stream
+    void _flush ();
+
+  public:
+
+    // Default constructor
+    output ()
+      : _position {0},
+	_stream {nullptr},
+	_nbbytes {0}
+    {}
+
+    // start writing into the given stream, with no bytes written yet
+    void open (ostream& stream);
+
+    // write the output pending into the stream, and return the number of
+    // bytes written since it was opened
+    uint64_t close ();
+
+    // write the given text, character or number
+    void put (string_view text);
+    void put (char c)
+    {
+      if (_position == _buffer.size ())
+	_flush ();
+      _buffer[_position++] = c;
+    }
+    void put (uint64_t number);
+
+  }; // class output
+
+} // namespace dot
+
+#endif 	    /* !OUTPUT_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -1,6 +1,6 @@
 /* 
   DOTparser.cc
-  Description: Simple dot language parser implemented using regular
+  Description: Simple dot language parser
   ----------------------------------------------------------------------------- 
 
   Started on  <Fri Jul  1 20:24:29 2016 Carlos Linares Lopez>
@@ -16,367 +16,300 @@
   Login   <clinares@atlas>
 */
 
+#include <cstdio>
+#include <cstdlib>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "DOTparser.h"
+#include "DOTsnapshot.h"
 
 // Private services
 // ----------------------------------------------------------------------------
 
-// return in contents all the contents of the dot file stored in _filename. It
-// returns true if the operation was successfully performed. Otherwise, it
-// returns false
-//
-// the following is deemed as the fastes C++ way for reading the entire contents
-// of a file into a single string. Others might prefer buffer iterators but that
-// is surprisingly slow.
-//
-// See: http://insanecoding.blogspot.com/2011/11/how-to-read-in-file-in-c.html
-bool dot::parser::_read_file(string& contents) const
+// parse the file given in the explicit constructor with the given number of
+// threads, restoring it from the cache, if any, whenever it was parsed before
+bool dot::parser::_parse_file (unsigned int nbthreads)
 {
-  std::ifstream in(_filename, std::ios::in);
-  if (in) {
-    
-    in.seekg (0, std::ios::end);
-    contents.resize (in.tellg ());
-    in.seekg (0, std::ios::beg);
-    in.read (&contents[0], contents.size ());
-    in.close ();
-    return true;
-  }
-
-  // if it was not possible to open the input stream, then return false
-  return false;
-}
 
-// the following methods parse different types according to the given
-// regexp. The second and third methods return in value the matching of the
-// given regexp.
+  // read the file
+  input contents;
+  if (!_read_file (contents))
+    throw invalid_argument ("file not found '" + _filename + "'");
 
-// just simply parse a regular expression. It return true if the given string
-// was parsed and false otherwise.
-bool dot::parser::_parse_void (string& content, const string& regexp) const
-{
-  smatch matches;
-  regex pattern {regexp};                                   // create the regex
-  if (regex_search (content, matches, pattern)) {  // in case a match was found
-    content = matches.suffix ();   // move to the suffix of the original string
-    return true;                                     // and return with success
+  // snapshots in the cache contain whole graphs, so that they can be used only
+  // if nothing was parsed before
+  if (_cache.empty () || _ids.size () || _label.size () || _type.size ())
+    return parse_string (contents.get_contents (), nbthreads);
+
+  // files are stored in the cache by their full path, so that every file has
+  // at most one snapshot which is replaced whenever it changes. Snapshots are
+  // used only if the size, time of last modification and hash of the
+  // contents of the file are the same than those stored in them
+  struct stat status {};
+  char* path = realpath (_filename.c_str (), nullptr);
+  uint64_t key = fnv1a (path ? path : _filename);
+  free (path);
+  stat (_filename.c_str (), &status);
+  uint64_t size = status.st_size;
+  int64_t mtime = status.st_mtime;
+  uint64_t checksum = fnv1a_words (contents.get_contents ());
+  char name[17];
+  snprintf (name, sizeof name, "%016llx", (unsigned long long) key);
+  string entry = _cache + "/" + name + ".snapshot";
+
+  // if a snapshot of the same contents is found, then restore it
+  try {
+    snapshot cached {entry};
+    if (cached.load () && cached.get_checksum () == checksum &&
+	cached.get_size () == size && cached.get_mtime () == mtime) {
+      cached.restore (*this);
+      return true;
+    }
+  } catch (const invalid_argument&) {}
+
+  // otherwise, parse the file and store its snapshot. It is written into a
+  // temporary file first which is then renamed, so that other processes never
+  // find incomplete snapshots. Graphs with syntax errors (which are parsed
+  // only in recovery mode) are not stored
+  bool result = parse_string (contents.get_contents (), nbthreads);
+  if (!result)
+    return result;
+  string tmpname = entry + ".XXXXXX";
+  int fd = mkstemp (&tmpname[0]);
+  if (fd >= 0) {
+    close (fd);
+    try {
+      snapshot::save (*this, tmpname, checksum, size, mtime);
+      if (rename (tmpname.c_str (), entry.c_str ()) == 0)
+	return result;
+    } catch (const invalid_argument&) {}
+    remove (tmpname.c_str ());
   }
-  return false;                                  // otherwise exit with failure
+  return result;
 }
 
-// parse a string and return its value in 'value' It return true if the given
-// string was parsed and false otherwise.
-bool dot::parser::_parse_string (string& content, const string& regexp,
-				 string& value) const
+// make available in contents all the contents of the dot file stored in
+// _filename. Regular files are mapped into memory rather than copied. It
+// returns true if the operation was successfully performed. Otherwise, it
+// returns false
+bool dot::parser::_read_file(input& contents) const
 {
-  smatch matches;
-  regex pattern {regexp};                                   // create the regex
-  if (regex_search (content, matches, pattern)) {  // in case a match was found
-    value = matches [1];                                      // copy the value
-    content = matches.suffix ();   // move to the suffix of the original string
-    return true;                                     // and return with success
-  }
-  return false;                                  // otherwise exit with failure
+  return contents.open (_filename);
 }
 
-// parse an unsigned int and return its value in 'value' It return true if the
-// given string was parsed and false otherwise.
-bool dot::parser::_parse_unsigned_int (string& content, const string& regexp, 
-				       unsigned int& value) const
+// return the identifier of the given vertex, which is added to the graph with
+// no neighbours and no attributes if it was not found
+uint32_t dot::parser::_get_vertex (string_view name)
 {
-  smatch matches;
-  regex pattern {regexp};                                   // create the regex
-  if (regex_search (content, matches, pattern)) {  // in case a match was found
-    value = (unsigned int) atoi (string (matches[1]).c_str ());
-    return true;                                     // and return with success
+  uint32_t id = _ids.intern (name);
+  if (id == _graph.size ()) {
+    _graph.emplace_back ();
+    _vertex.emplace_back ();
   }
-  return false;                                  // otherwise exit with failure
+  return id;
 }
 
-// skips the section of contents if it contains comments. It returns the
-// contents that result after stripping the leading comments. It honors both C
-// and C++ comments (as specified in the dot language)
-void dot::parser::_parse_comments (string& contents) const
+// return the identifier of the vertex with the given name. In case no vertex is
+// found with the given name an exception is raised
+uint32_t dot::parser::_find_vertex (string_view name) const
 {
-
-  // both types of comments are acknowledged using regexps. The key question is
-  // that there might be an arbitrary number of comments one following the other
-  // at the beginning of contents
-  while (_parse_void (contents, CPP_COMMENT));
+  uint32_t id = _ids.find (name);
+  if (id == interner::npos)
+    throw dot::syntax_error (" No node with the name '" + string (name) + "' has been found");
+  return id;
 }
 
-// parse the given contents and if the specified regexp matches then its value
-// is returned. Additionally, it is shown prefixed by a label on the standard
-// output if and only if verbose is enabled
-bool dot::parser::_read_string (string& contents, const string& regexp, string& value, const string& label) const
-{
-  _parse_comments (contents);
-  if (_parse_string (contents, regexp, value))
-    show_value (label, value, _verbose);
-  else 
-    return false;
-  return true;
-}  
-
-// parse the given contents and return true if the given regexp
-// matches. Additionally, it shows the given label if and only if verbose is
-// enabled
-bool dot::parser::_read_void (string& contents, const string& regexp, const string& label) const
-{
-  _parse_comments (contents);
-  if (_parse_void (contents, regexp))
-    show_void (label, _verbose);
-  else
-    return false;
-  return true;
-}
-
-// updates the contents of the graph adding the edge orig->target and, if
-// the arc is undirected, it adds also the edge target->orig. Finally,
-// because the list of vertices is computed from the matrix of adjacency,
-// then target is added to the graph even if it has no neighbours.
-void dot::parser::_update_graph (const string& orig_name, const string& edge_type, const string& target_name)
+// updates the contents of the graph adding the edge orig->target and, if the
+// arc is undirected, it adds also the edge target->orig.
+void dot::parser::_update_graph (uint32_t orig, bool directed, uint32_t target)
 {
+  DOT_STATS_PHASE (_stats, phase::graph_updates);
 
   // make sure this target vertex was not processed before
-  if (find (_graph[orig_name].begin (), _graph[orig_name].end (),
-	    target_name) == _graph[orig_name].end ())
-    _graph[orig_name].push_back (target_name);
+  if (_edges.insert (_edge_key (orig, target)).second)
+    _graph[orig].push_back (target);
 
   // if the edge is undirected, then add the edge in the opposite direction as
   // well
-  if (edge_type!="->")
-    if (find (_graph[target_name].begin (), _graph[target_name].end (),
-	      orig_name) == _graph[target_name].end ())
-      _graph[target_name].push_back (orig_name);
-
-  // and do not forget to add the target vertex to the graph even if it
-  // has no neighbours
-  if (edge_type == "->" && _graph.find (target_name) == _graph.end ()) 
-    _graph[target_name] = vector<string>();
+  if (!directed && _edges.insert (_edge_key (target, orig)).second)
+    _graph[target].push_back (orig);
 }
-    
-// parse an attributes section. The attributes read are return as a map that
-// stores for every attribute its value as a string. It returns true if any
-// attributes were found and raises an exception otherwise
-bool dot::parser::_process_attributes (string& contents, map<string, string>& dict) const
-{
-  // check if the current contents start with an attributes section
-  if (_parse_void (contents, ATTRIBUTE_BEGIN)) {
-
-    bool eoattr = false;
-    while (!eoattr) {
-	
-      string attrname, attrvalue;
-	
-      // yeah, an attributes section is started, so process it. Start getting
-      // the name of the next attribute
-      if (_parse_string (contents, ATTRIBUTE_NAME, attrname)) 
-	show_value ("\tATTRIBUTE", attrname, _verbose);
-      else 
-	throw dot::syntax_error ("an ATTRIBUTE_NAME could not be parsed");
-
-      // try first to read the value of this attribute followed by and end
-      // of attribute section (']')
-      if ((eoattr = _parse_string (contents, ATTRIBUTE_VALUE_END, attrvalue))) {
-
-	// Make sure to remove the double quotes in case they were given
-	if (attrvalue [0] == '"' && attrvalue[attrvalue.size () - 1] =='"')
-	  attrvalue = attrvalue.substr (1, attrvalue.size () - 2);
-	show_value ("\tVALUE (*)", attrvalue, _verbose);
-
-	// store the last read pair in the map
-	dict[attrname] = attrvalue;
-      }
 
-      // otherwise, read the next value followed by a comma
-      else if (_parse_string (contents, ATTRIBUTE_VALUE_NEXT, attrvalue)) {
+// merge the given attributes into dict, so that the values already stored
+// prevail. If an attribute is given more than once, the last value is taken
+//
+// Attributes are traversed backwards, so that only the last value of every
+// attribute is inserted, and only if it was not stored yet
+void dot::parser::_merge (attribute_map& dict, const attributes& attrs)
+{
+  for (auto iattr = attrs.rbegin () ; iattr != attrs.rend () ; ++iattr) {
 
-	// Make sure to remove the double quotes in case they were given
-	if (attrvalue [0] == '"' && attrvalue[attrvalue.size () - 1] =='"')
-	  attrvalue = attrvalue.substr (1, attrvalue.size () - 2);
-	show_value ("\tVALUE", attrvalue, _verbose);
+    // the attribute is looked up with a view to avoid creating a key in the
+    // memory resource unless it is actually inserted
+    auto ientry = dict.lower_bound (iattr->first);
+    if (ientry == dict.end () || ientry->first != iattr->first)
+      dict.emplace_hint (ientry, iattr->first, iattr->second);
+  }
+}
 
-	// store the last read pair in the map
-	dict[attrname] = attrvalue;
-      }
+// return a copy of the given attributes
+std::map<std::string, std::string> dot::parser::_copy (const attribute_map& attrs)
+{
+  map<string, string> copy;
+  for (auto& iattr : attrs)
+    copy.emplace_hint (copy.end (), iattr.first, iattr.second.get_text ());
+  return copy;
+}
 
-      // if neither the attribute section is finished nor it is continued with
-      // other assignments, then an error should be raise
-      else 
-	throw dot::syntax_error ("an ATTRIBUTE_VALUE could not be parsed");
+// the header of the graph
+void dot::parser::graph (string_view type, string_view name)
+{
+  _type = type;
+  _name = name;
+}
 
-      // check anyway if the attributes section gets closed here (this is good,
-      // e.g., for preventing empty attributes sections)
-      eoattr = _parse_void (contents, ATTRIBUTE_END) || eoattr;
-    }
+// a label with its value
+void dot::parser::label (string_view name, string_view value)
+{
+  auto ilabel = _label.find (name);
+  if (ilabel == _label.end ())
+    _label.emplace (name, value);
+  else
+    ilabel->second = value;
+}
 
-    // and return that an attribute section was successfully processed
-    return true;
-  }
+// a node statement
+void dot::parser::vertex (string_view name)
+{
 
-  // at this point, no attribute section was processed
-  return false;
+  // just record this vertex with no neighbours unless it was already inserted
+  _get_vertex (name);
 }
 
-// process the value of a label named labelid. This method should be invoked
-// only when a label identifier has been found in contents which should then
-// start with the value of the label. It returns true if it could successfully
-// determine the label value and raises an exception otherwise
-bool dot::parser::_process_label_value (string& contents, const string& labelid)
+// the attributes of a vertex
+void dot::parser::vertex_attributes (string_view name, const attributes& attrs)
 {
+  _merge (_vertex[_get_vertex (name)], attrs);
+}
 
-  string label_value;
-  if (!_read_string (contents, LABEL_VALUE, label_value, "LABEL VALUE"))
-    throw dot::syntax_error ("it was not possible to read a LABEL_VALUE");
-  
-  // if a value could be successfully processed for this label, then store
-  // it. Make sure to remove the double quotes in case they were given
-  if (label_value [0] == '"' && label_value[label_value.size () - 1] =='"')
-    label_value = label_value.substr (1, label_value.size () - 2);
-  _label[labelid] = label_value;
-  return true;
+// an edge, either directed or undirected. Note that both vertices are added to
+// the graph even if they have no neighbours
+void dot::parser::edge (string_view orig, string_view target, bool directed)
+{
+  uint32_t orig_id = _get_vertex (orig);
+  _update_graph (orig_id, directed, _get_vertex (target));
 }
 
-// process the attributes of an edge joining two single vertices, orig_name and
-// target_name, of the specified type edge_type, given in arcdict. It also
-// processes the attributes of the target vertex if any are given in
-// contents. It returns true upon successful completion and false otherwise
-bool dot::parser::_process_single_vertex (string& contents,
-					  const string& orig_name, const string& edge_type,
-					  const string& target_name, map<string, string> arcdict)
+// the attributes of an edge, which are annotated in both directions if the edge
+// is undirected
+void dot::parser::edge_attributes (string_view orig, string_view target, bool directed,
+				   const attributes& attrs)
 {
 
-  // first, process the edge attributes: if and only if any edge attributes were
-  // given
-  if (arcdict.size ()) {
+  // Syntax: [orig][target][attr name] = attr value
+  uint32_t orig_id = _get_vertex (orig);
+  uint32_t target_id = _get_vertex (target);
+  _merge (_edge[_edge_key (orig_id, target_id)], attrs);
 
-    map<string, string> mergeddict {arcdict};
-    
-    // Syntax: [orig][target][attr name] = attr value
-    _edge[orig_name][target_name].merge (arcdict);
-
-    // also, in case this is an edge of the form "--" then annotate the same
-    // attributes in the reversed direction
-    if (edge_type == "--") {
-      arcdict = mergeddict;
-      _edge[target_name][orig_name].merge (arcdict);
-    }
-  }
-		
-  // and process also this vertex attributes, if given
-  map<string, string> targetdict;
-  if (_process_attributes (contents, targetdict))
-    _vertex [target_name].merge (targetdict);
+  // also, in case this is an edge of the form "--" then annotate the same
+  // attributes in the reversed direction
+  if (!directed)
+    _merge (_edge[_edge_key (target_id, orig_id)], attrs);
+}
 
-  return true;
+// add to the given table an empty column for every attribute in attrs which has
+// none yet
+void dot::parser::_add_columns (columns& table, const attribute_map& attrs)
+{
+  for (auto& iattr : attrs)
+    if (!table.has_column (iattr.first))
+      table._columns[string (iattr.first)]._resize (table._size);
 }
-    
-// process a multiple declaration of target vertices which should appear right
-// at the beginning of the specified contents. The original vertex, type of edge
-// and any edge attributes specified previously should be given now in
-// orig_name, edge_type and arcdict. It returns true if and only if the block
-// could be successfully parsed and raises an exception otherwise
-bool dot::parser::_process_multiple_vertices (string& contents, const string& orig_name,
-					      const string& edge_type, map<string, string>& arcdict)
+
+// return the value of the label with the specified name. In case no label is
+// found with the given name an exception is raised
+const dot::value& dot::parser::_get_label (const string& name) const
 {
+  auto ilabel = _label.find (string_view (name));
+  if (ilabel == _label.end ())
+    throw dot::syntax_error (" No label with the name '" + name + "' has been found");
+  return ilabel->second;
+}
 
-  string target_name;
-  
-  // Multiple targets consist of an arbitrarily large list of vertices between
-  // curly brackets
-  if (_parse_void (contents, BLOCK_BEGIN)) {
-    show_void (" --- Beginning multiple target specification ---", _verbose);
-    bool eomts = false;           // end of multiple target specification
-    while (!eomts) {
-
-      // unless the multiple target specification is over
-      _parse_comments (contents);
-      if (!(eomts=_parse_void (contents, BLOCK_END))) {
-
-	// get the next vertex name
-	if (!_read_string (contents, VERTEX_NAME, target_name, "TARGET VERTEX"))
-	  throw dot::syntax_error ("TARGET_NAME could not be parsed");
-	else {
-
-	  // and update the graph with this edge
-	  _update_graph (orig_name, edge_type, target_name);
-	  
-	  // process now the edge attributes given to this vertex and, if given,
-	  // the attributes of the target vertex as well
-	  _process_single_vertex (contents, orig_name, edge_type, target_name, arcdict);
-	}
-      }
-    }
-    show_void (" --- Ending multiple target specification ---", _verbose);
-  }
-  else
-    throw dot::syntax_error ("a block with a declaration of multiple vertices could not be parsed");
+// return the value of an attribute defined for a specific vertex. In case no
+// node is found with the given node, or no attribute with the given name is
+// found for the specified node, an exception is raised
+const dot::value& dot::parser::_get_vertex_attribute (const string& name,
+						      const string& attrname) const
+{
+
+  // verify that the specified name actually exists
+  uint32_t id = _find_vertex (name);
+
+  // verify there is an attribute with the given name
+  auto iattr = _vertex[id].find (string_view (attrname));
+  if (iattr == _vertex[id].end ())
+    throw dot::syntax_error (" The node '" + name + "' has no attribute with the name '" + attrname + "'");
 
-  return true;
+  // at this point, both the vertex and the attribute name are known to exist,
+  // so that report it
+  return iattr->second;
 }
 
-// process a trajectory or path defined over single definitions of vertices from
-// the origin vertex specified which, however, could be terminated with a block
-// with multiple vertices. It returns true upon successful completion of the
-// trajectory and raises an exception otherwise
-bool dot::parser::_process_trajectory (string& contents, string& orig_name)
+// return the attributes of the edge (origin,target), or null if it has
+// none. If either the origin does not exist, or the target is not found to be a
+// neighbour of the origin, an exception is raised
+const dot::parser::attribute_map* dot::parser::_get_edge (const string& origin,
+							  const string& target) const
 {
 
-  string edge_type;
-  string target_name;
-  int pathlength = 0;
-
-  // in case a block with multiple vertices is found, it is necessary to enable
-  // the following flag to ensure that no edges follow it
-  bool block_found = false;
-  
-  // while an edge is found in contents
-  while (_read_string (contents, EDGE_TYPE, edge_type, "EDGE TYPE")) {
-
-    // first of all, if an edge follows a block with multiple vertices then a
-    // syntax error should be raised
-    if (block_found)
-      throw dot::syntax_error ("an edge was found immediately after a block with multiple vertices");
-	  
-    // yeah! A path is listed, parse the attributes of this edge if any were
-    // given
-    map<string, string> arcdict;
-    _process_attributes (contents, arcdict);
-
-    // get the target vertex of this specific edge
-    if (!_read_string (contents, VERTEX_NAME, target_name, "TARGET VERTEX")) {
-
-      // if a target vertex could not be retrieved, then the only option is that
-      // a block with multiple vertices is declared, but we should make sure
-      // that this is the last part of the statement so that no edges can follow
-      // it
-      _process_multiple_vertices (contents, orig_name, edge_type, arcdict);
-      block_found = true;
-    }
-    else {
-
-      // and update the graph with this edge
-      _update_graph (orig_name, edge_type, target_name);
-	  
-      // and update all the edge attributes of this edge and also the attributes
-      // of the target vertex if any were given
-      _process_single_vertex (contents, orig_name, edge_type, target_name, arcdict);
-    }
+  // verify that the specified origin actually exists
+  uint32_t orig_id = _find_vertex (origin);
 
-    // and now make the
-    orig_name = target_name;
+  // verify now that the target is reachable from the origin
+  uint32_t target_id = _ids.find (target);
+  if (target_id == interner::npos || !_edges.count (_edge_key (orig_id, target_id)))
+    throw dot::syntax_error (" The node '" + origin + "' has no neighbour with the name '" + target + "'");
 
-    // and increment the path length
-    pathlength++;
-  }
+  // and return the attributes of this edge, if any
+  auto iedge = _edge.find (_edge_key (orig_id, target_id));
+  return iedge == _edge.end () ? nullptr : &iedge->second;
+}
 
-  // if no edge was found, then raise a syntax error
-  if (!pathlength)
-    throw dot::syntax_error ("no EDGE_TYPE has been provided");
+// return the attributes of the edge orig->target, which are empty if it has
+// none. The edge is not verified to exist
+const dot::parser::attribute_map& dot::parser::_get_edge_attribute_map (uint32_t orig,
+									uint32_t target) const
+{
+  static const attribute_map empty;
+  auto iedge = _edge.find (_edge_key (orig, target));
+  return iedge == _edge.end () ? empty : iedge->second;
+}
 
-  // otherwise leave gracefully
-  return true;
+// return the value of the given attribute defined for the edge
+// (origin,target). If either the origin does not exist, or the target is not
+// found to be a neighbour of the origin, or the edge has attributes but none
+// with the given name, an exception is raised. Edges with no attributes at all
+// have an empty value for every attribute
+const dot::value& dot::parser::_get_edge_attribute (const string& origin,
+						    const string& target,
+						    const string& attrname) const
+{
+  static const value empty;
+
+  // verify that the edge exists and retrieve its attributes
+  const attribute_map* attrs = _get_edge (origin, target);
+  if (!attrs || attrs->empty ())
+    return empty;
+
+  // in case the edge has attributes but none with the specified name, raise an
+  // exception
+  auto iattr = attrs->find (string_view (attrname));
+  if (iattr == attrs->end ())
+    throw dot::syntax_error (" The edge joining vertices '" + origin + "' and '" + target + "' has no attribute named '" + attrname + "'");
+  return iattr->second;
 }
 
 // Public services
@@ -389,7 +322,7 @@ std::vector<std::string> dot::parser::get_labels () const
 
   // now, go over the adjacency map retrieving the names of all vertices
   for (auto& ilabel : _label)
-    labels.push_back (ilabel.first);
+    labels.push_back (string (ilabel.first));
 
   return labels;
 }
@@ -397,23 +330,18 @@ std::vector<std::string> dot::parser::get_labels () const
 // get the value of the label with the specified name
 std::string dot::parser::get_label_value (const string& name)
 {
-
-  // verify that the specified label actually exists
-  if (_label.find (name) == _label.end ())
-    throw dot::syntax_error (" No label with the name '" + name + "' has been found");
-
-  // otherwise return the value of this label
-  return _label[name];
+  return string (_get_label (name).get_text ());
 }
     
-// get all source vertices of the graph
+// get all source vertices of the graph, sorted by name
 std::vector<std::string> dot::parser::get_vertices () const
 {
   vector<string> vertices;
 
-  // now, go over the adjacency map retrieving the names of all vertices
-  for (auto& ivertex : _graph)
-    vertices.push_back (ivertex.first);
+  // now, go over all vertices retrieving their names
+  for (uint32_t id = 0 ; id < _ids.size () ; id++)
+    vertices.push_back (string (_ids.get_name (id)));
+  sort (vertices.begin (), vertices.end ());
 
   return vertices;
 }
@@ -423,43 +351,140 @@ std::vector<std::string> dot::parser::get_vertices () const
 std::map<std::string, std::vector<std::string>> dot::parser::get_graph () const
 {
 
-  // vertices are directly returned by traversing the data member _graph which
-  // is indexed by vertices. In the case of digraphs, it might be the case that
-  // u->v is present in the graph but v is not the source vertex of any edge. If
-  // u->v is found in the DOT specification, then v is added to the graph with
-  // no neighbours but we should not return an edge from v to no
-  // neighbours. Thus, it is necessary to traverse the entire graph to return
-  // only meaningful edges
+  // In the case of digraphs, it might be the case that u->v is present in the
+  // graph but v is not the source vertex of any edge. If u->v is found in the
+  // DOT specification, then v is added to the graph with no neighbours but we
+  // should not return an edge from v to no neighbours. Thus, it is necessary to
+  // traverse the entire graph to return only meaningful edges
   map<string, vector<string>> graph;
 
   // for all vertices in the graph
-  for (auto& vertex : _graph)
+  for (uint32_t id = 0 ; id < _graph.size () ; id++)
 
     // if and only if this vertex has neighbours
-    if (vertex.second.size () > 0)
-      graph [vertex.first] = vertex.second;
+    if (_graph[id].size () > 0) {
+      vector<string>& neighbours = graph [string (_ids.get_name (id))];
+      for (auto neighbour : _graph[id])
+	neighbours.push_back (string (_ids.get_name (neighbour)));
+    }
 
   // and return the graph with meaningful edges
   return graph;
 }
 
 // get all nodes that are reachable from a given node. In case no node is
-    // found with the given node an exception is raised.
+// found with the given node an exception is raised.
 std::vector<std::string> dot::parser::get_neighbours (const string& name)
 {
 
   // verify that the specified name actually exists
-  if (_graph.find (name) == _graph.end ())
-    throw dot::syntax_error (" No node with the name '" + name + "' has been found");
+  uint32_t id = _find_vertex (name);
 
   // otherwise return a vector with all neighbours of this node
-  return _graph[name];
+  vector<string> neighbours;
+  for (auto neighbour : _graph[id])
+    neighbours.push_back (string (_ids.get_name (neighbour)));
+  return neighbours;
+}
+
+// return the graph in compressed sparse row format, where vertices are given
+// the same identifiers used in this parser. It is built in one pass over the
+// adjacency lists, and neighbours are stored in the same order than in
+// get_neighbour_ids
+dot::csr dot::parser::get_csr () const
+{
+  csr graph;
+
+  // first, reserve memory for all vertices and edges. Offsets are stored
+  // with 32 bits, so that the number of edges is bounded
+  size_t nb_edges = 0;
+  for (auto& neighbours : _graph)
+    nb_edges += neighbours.size ();
+  if (nb_edges > numeric_limits<uint32_t>::max ())
+    throw invalid_argument ("the graph has " + to_string (nb_edges) + " edges, but no more than " +
+			    to_string (numeric_limits<uint32_t>::max ()) + " can be stored in CSR format");
+  graph._offsets.reserve (_graph.size () + 1);
+  graph._targets.reserve (nb_edges);
+  graph._attribute_ids.reserve (nb_edges);
+
+  // and now copy the neighbours of every vertex after those of the previous
+  // one, along with the index of their attributes, if any
+  for (uint32_t id = 0 ; id < _graph.size () ; id++) {
+    for (auto neighbour : _graph[id]) {
+      graph._targets.push_back (neighbour);
+      auto iattrs = _edge.find (_edge_key (id, neighbour));
+      if (iattrs == _edge.end () || iattrs->second.empty ())
+	graph._attribute_ids.push_back (csr::npos);
+      else {
+	graph._attribute_ids.push_back (graph._attributes.size ());
+	graph._attributes.push_back (_copy (iattrs->second));
+      }
+    }
+    graph._offsets.push_back (graph._targets.size ());
+  }
+
+  return graph;
+}
+
+// return the attributes of all vertices stored in columns, one per attribute
+// name, where vertices are given the same identifiers used in this parser
+dot::columns dot::parser::get_vertex_columns () const
+{
+  columns table;
+  table._size = _vertex.size ();
+
+  // first, create a column for every attribute name
+  for (auto& attrs : _vertex)
+    _add_columns (table, attrs);
+
+  // and then set the values of all vertices in increasing order of their
+  // identifiers
+  for (uint32_t id = 0 ; id < _vertex.size () ; id++)
+    for (auto& iattr : _vertex[id])
+      table._columns.find (string_view (iattr.first))->second._set (id, iattr.second);
+  for (auto& icolumn : table._columns)
+    icolumn.second._close ();
+
+  return table;
+}
+
+// return the attributes of all edges stored in columns, one per attribute
+// name, where edges are given the same indices than in get_csr
+dot::columns dot::parser::get_edge_columns () const
+{
+  columns table;
+  for (auto& neighbours : _graph)
+    table._size += neighbours.size ();
+
+  // first, create a column for every attribute name
+  for (auto& iedge : _edge)
+    _add_columns (table, iedge.second);
+
+  // and then set the values of all edges in the same order they are stored in
+  // the CSR format
+  size_t edge = 0;
+  for (uint32_t id = 0 ; id < _graph.size () ; id++)
+    for (auto neighbour : _graph[id]) {
+      auto iattrs = _edge.find (_edge_key (id, neighbour));
+      if (iattrs != _edge.end ())
+	for (auto& iattr : iattrs->second)
+	  table._columns.find (string_view (iattr.first))->second._set (edge, iattr.second);
+      edge++;
+    }
+  for (auto& icolumn : table._columns)
+    icolumn.second._close ();
+
+  return table;
 }
 
 // get all attributes of all vertices of the graph
 std::map<std::string, std::map<std::string, std::string>> dot::parser::get_all_vertex_attributes () const
 {
-  return _vertex;
+  map<string, map<string, string>> attrs;
+  for (uint32_t id = 0 ; id < _vertex.size () ; id++)
+    if (_vertex[id].size ())
+      attrs[string (_ids.get_name (id))] = _copy (_vertex[id]);
+  return attrs;
 }
 
 // get all the attributes of the specified vertex. In case no node is found with
@@ -467,17 +492,9 @@ std::map<std::string, std::map<std::string, std::string>> dot::parser::get_all_v
 std::map<std::string, std::string> dot::parser::get_vertex_attributes (const string& name)
 {
   
-  // verify that the specified name actually exists
-  if (_graph.find (name) == _graph.end ())
-    throw dot::syntax_error (" No node with the name '" + name + "' has been found");
-
-  // now, in case there are no vertices defined for this vertex, return an empty
-  // map
-  if (_vertex.find (name) == _vertex.end ())
-    return map<string, string>();
-
-  // otherwise, return its attributes
-  return _vertex[name];
+  // verify that the specified name actually exists and return its attributes,
+  // if any
+  return _copy (_vertex[_find_vertex (name)]);
 }
 
 // return the value of an attribute defined for a specific vertex. In case no
@@ -485,24 +502,16 @@ std::map<std::string, std::string> dot::parser::get_vertex_attributes (const str
 // found for the specified node, an exception is raised.
 std::string dot::parser::get_vertex_attribute (const string& name, const string& attrname)
 {
-
-  // verify that the specified name actually exists
-  if (_graph.find (name) == _graph.end ())
-    throw dot::syntax_error (" No node with the name '" + name + "' has been found");
-
-  // verify there is an attribute with the given name
-  if (_vertex[name].find (attrname) == _vertex[name].end ())
-    throw dot::syntax_error (" The node '" + name + "' has no attribute with the name '" + attrname + "'");
-
-  // at this point, both the vertex and the attribute name are known to exist,
-  // so that report it
-  return _vertex[name][attrname];
+  return string (_get_vertex_attribute (name, attrname).get_text ());
 }
 
 // get the edge attributes for all edges in the graph that have any
 std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> dot::parser::get_all_edge_attributes ()
 {
-  return _edge;
+  map<string, map<string, map<string, string>>> attrs;
+  for (auto& iedge : _edge)
+    attrs[string (_ids.get_name (iedge.first >> 32))][string (_ids.get_name (uint32_t (iedge.first)))] = _copy (iedge.second);
+  return attrs;
 }
 
 // get all the attributes of a specific edge qualified by its (origin,target)
@@ -511,20 +520,10 @@ std::map<std::string, std::map<std::string, std::map<std::string, std::string>>>
 std::map<std::string, std::string> dot::parser::get_edge_attributes (const string& origin,
 								     const string& target)
 {
-  map<string, string> attrs;
-
-  // verify that the specified origin actually exists
-  if (_graph.find (origin) == _graph.end ())
-    throw dot::syntax_error (" No node with the name '" + origin + "' has been found");
-
-  // verify now that the target is reachable from the origin. I know linear time
-  // but the list of vertices should not be expected to be too large ... I
-  // guess! ;)
-  if (find (_graph[origin].begin (), _graph[origin].end (), target) == _graph[origin].end ())
-    throw dot::syntax_error (" The node '" + origin + "' has no neighbour with the name '" + target + "'");
-
-  // and return the attributes of this edge
-  return _edge [origin][target];
+  const attribute_map* attrs = _get_edge (origin, target);
+  if (!attrs)
+    return map<string, string>();
+  return _copy (*attrs);
 }
 
 // return the value of the given attribute defined for the vertex qualified by
@@ -535,114 +534,79 @@ std::string dot::parser::get_edge_attribute (const string& origin,
 					     const string& target,
 					     const string& attrname)
 {
+  return string (_get_edge_attribute (origin, target, attrname).get_text ());
+}
 
-  // verify that the specified origin actually exists
-  if (_graph.find (origin) == _graph.end ())
-    throw dot::syntax_error (" No node with the name '" + origin + "' has been found");
-
-  // verify now that the target is reachable from the origin. I know linear time
-  // but the list of vertices should not be expected to be too large ... I
-  // guess! ;)
-  if (find (_graph[origin].begin (), _graph[origin].end (), target) == _graph[origin].end ())
-    throw dot::syntax_error (" The node '" + origin + "' has no neighbour with the name '" + target + "'");
-
-  // now, verify that the pair (origin,target) exists in the map of edge
-  // attributes
-  typename map<string,map<string,map<string,string>>>::iterator iattrs = _edge.find (origin);
-  if (iattrs!=_edge.end ()) {
-    typename map<string,map<string,string>>::iterator jattrs = iattrs->second.find (target);
-    if (jattrs != iattrs->second.end ()) {
-
-      // in case there is no attribute with the specified name, raise an
-      // exception
-      if (jattrs->second.find (attrname) == jattrs->second.end ())
-	throw dot::syntax_error (" The edge joining vertices '" + origin + "' and '" + target + "' has no attribute named '" + attrname + "'");
-    }
+// return the statistics of all the contents parsed so far along with the
+// memory allocated and the size of the graph
+dot::stats dot::parser::get_stats () const
+{
+  stats result;
+  if (!stats::enabled)
+    return result;
+
+  // the phases and tokens are collected by the reader, but for the updates of
+  // the graph
+  result += _reader.get_stats ();
+  result += _stats;
+  if (_counter) {
+    result.allocations = _counter->get_allocations ();
+    result.allocated_bytes = _counter->get_bytes ();
+    result.peak_memory = _counter->get_peak ();
   }
-
-  // at this point, both the origin and the target are known to exist. Besides,
-  // an attribute with the specified name is known to exist for the edge joining
-  // those vertices, so just retrieve it
-  return _edge[origin][target][attrname];
+  result.nb_vertices = _graph.size ();
+  result.nb_edges = _edges.size ();
+  result.nb_labels = _label.size ();
+  for (const auto& neighbours : _graph)
+    result.peak_degree = max (result.peak_degree, neighbours.size ());
+  return result;
 }
 
 // parse the given string. It returns true if the string could be successfully
 // parse. Otherwise, it raises an exception with an error message
-bool dot::parser::parse_string (string contents)
+bool dot::parser::parse_string (string_view contents)
 {
+  return _reader.parse_string (contents, *this);
+}
 
-  // get the graph type
-  // REMARK - "strict" is not acknowledged!
-  if (!_read_string (contents, GRAPH_TYPE, _type, "TYPE"))
-    throw dot::syntax_error ("GRAPH type could not be parsed");
-  
-  // get the graph name
-  // REMARK - the graph name is entirely optional
-  if (!_read_string (contents, GRAPH_NAME, _name, "NAME"))
-    throw dot::syntax_error ("NAME could not be parsed");
-  
-  // block start
-  if (!_read_void (contents, BLOCK_BEGIN, "--- Block begin found ---"))
-    throw dot::syntax_error ("BEGIN OF BLOCK missing");
-  
-  // now, process all edges of the graph
-  bool eob = false;                                             // end of block
-  while (!eob) {
-
-    // unless we are closing the block at this point
-    _parse_comments (contents);
-    if (!(eob=_parse_void (contents, BLOCK_END))) {
-
-      // at the beginning of each line we could have either a vertex name, or a
-      // label. Try first, reading a label
-      string orig_name;
-      if (_read_string (contents, LABEL_ASSIGNMENT, orig_name, "LABEL ID")) {
-
-	// if a label was found, then retrieve its value and store it in this
-	// parser
-	_process_label_value (contents, orig_name);
-
-	// this completes the processing of a single statement, consume the
-	// semicolon in case it has been given
-	_parse_comments (contents);
-	_parse_void (contents, END_OF_STATEMENT);
-	continue;
-      }
-      else 
-	if (!_read_string (contents, VERTEX_NAME, orig_name, "SOURCE_VERTEX"))
-	  throw dot::syntax_error ("neither a VERTEX_NAME nor a LABEL_ID have been provided");
-
-      // and process also its attributes
-      map<string, string> origdict;
-      if (_process_attributes (contents, origdict))
-	_vertex [orig_name].merge (origdict);
-
-      // at this point, the statement could be over if it is a "node statement",
-      // i.e., a node along with its attributes. In this case, the statement
-      // should be ended with a semicolon
-      _parse_comments (contents);
-      if (_parse_void (contents, END_OF_STATEMENT)) {
-
-	// if so, just record this vertex with no neighbours unless it was
-	// already inserted and proceed with the next line
-	if (_graph.find (orig_name) == _graph.end ())
-	  _graph [orig_name] = vector<string>();
-	continue;
-      }
+// parse the given string using the given number of threads (all those
+// available if zero). The graph is precisely the same than when parsing
+// sequentially
+bool dot::parser::parse_string (string_view contents, unsigned int nbthreads)
+{
+  return _reader.parse_string (contents, *this, nbthreads);
+}
 
-      // and now process the entire trajectory from this original vertex
-      _process_trajectory (contents, orig_name);
-      
-      // this completes the processing of a single statement, consume the
-      // semicolon in case it has been given
-      _parse_comments (contents);
-      _parse_void (contents, END_OF_STATEMENT);
-    }
-  }
+// parse the given chunk of contents, which are appended to those given in
+// previous invocations. Statements are parsed as soon as they are known to be
+// complete, so that only the last incomplete statement is kept in
+// memory. Syntax errors are reported as soon as no contents given later could
+// fix them, and at the latest by finish ()
+void dot::parser::feed (const char* data, size_t size)
+{
+  _reader.feed (data, size, *this);
+}
 
-  show_void (" --- Block end found ---", _verbose);
-  
-  return true;                                                 // nicely return
+// parse all the contents which are still pending after feeding the last
+// chunk. It returns true if the graph was successfully parsed. Otherwise, it
+// raises an exception with an error message or, in recovery mode, it returns
+// false. In any case, the next chunk fed starts another graph
+bool dot::parser::finish ()
+{
+  return _reader.finish (*this);
+}
+
+// use the given directory (which is created if it does not exist) as a cache
+// of parsed files, or disable the cache if the directory is empty
+void dot::parser::set_cache (const string& directory)
+{
+
+  // the directory is created unless it already exists
+  struct stat status;
+  if (!directory.empty () && mkdir (directory.c_str (), 0755) &&
+      (stat (directory.c_str (), &status) || !S_ISDIR (status.st_mode)))
+    throw invalid_argument ("the cache directory '" + directory + "' could not be created");
+  _cache = directory;
 }
 
 // parse the file given in the explicit constructor of this instance. It returns
@@ -650,17 +614,19 @@ bool dot::parser::parse_string (string contents)
 // exception with an error message
 bool dot::parser::parse ()
 {
-  
-  // read the file
-  string contents;
-  if (!_read_file (contents))
-    throw invalid_argument ("file not found '" + _filename + "'");
 
-  // and now parse its contents
-  return parse_string (contents);
+  // parse the contents of the file directly from the mapped pages with a
+  // single thread, i.e., sequentially
+  return _parse_file (1);
 }
 
-
+// parse the file given in the explicit constructor of this instance using the
+// given number of threads (all those available if zero). The graph is precisely
+// the same than when parsing sequentially
+bool dot::parser::parse (unsigned int nbthreads)
+{
+  return _parse_file (nbthreads);
+}
 
 
 /* Local Variables: */
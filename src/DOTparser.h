@@ -1,7 +1,6 @@
 /* 
   DOTparser.h
-  Description: Simple dot language parser implemented using regular
-  expressions
+  Description: Simple dot language parser
   ----------------------------------------------------------------------------- 
 
   Started on  <Fri Jul  1 09:08:22 2016 Carlos Linares Lopez>
@@ -20,14 +19,29 @@
 #ifndef   	PARSER_H_
 # define   	PARSER_H_
 
+#include "DOTcolumns.h"
+#include "DOTcsr.h"
 #include "DOTdefs.h"
-
+#include "DOTinput.h"
+#include "DOTinterner.h"
+#include "DOTrange.h"
+#include "DOTreader.h"
+#include "DOTstats.h"
+#include "DOTtrace.h"
+#include "DOTvalue.h"
+
+#include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <iostream>
 #include <map>
-#include <regex>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -35,168 +49,415 @@ namespace dot {
 
   using namespace std;
 
-  // Struct definition
-  //
-  // Definition of a syntax error exception
-  struct syntax_error : public exception {
-
-    string _msg;                                        // syntax error message
-    
-    explicit syntax_error (const string& msg)
-      : _msg { msg }
-    {}
-      
-    virtual const char * what () const throw () {
-      return _msg.c_str ();
-    }
-  };
-
   // Class deifnition
   //
   // Definition of a dot parser
   class parser {
 
+  public:
+
+    // attributes are stored as maps that can be searched with views. Their
+    // values are decoded once, when they are stored
+    using attribute_map = pmr::map<pmr::string, value, less<>>;
+
+    // a vertex as given when traversing all vertices of the graph, with its
+    // identifier, name, neighbours and attributes. All of them are views over
+    // the contents of the parser
+    struct vertex_ref {
+      uint32_t id;                                 // identifier of the vertex
+      string_view name;                                  // name of the vertex
+      range<const uint32_t*> neighbours;      // identifiers of its neighbours
+      const attribute_map& attributes;                  // its attributes
+    };
+
+    // an edge as given when traversing all edges of the graph, with the
+    // identifiers of its vertices and its attributes, which are a view over
+    // the contents of the parser
+    struct edge_ref {
+      uint32_t origin;                           // identifier of the origin
+      uint32_t target;                           // identifier of the target
+      const attribute_map& attributes;                  // its attributes
+    };
+
+    // Class definition
+    //
+    // Definition of an iterator over all vertices of the graph, in increasing
+    // order of their identifiers
+    class vertex_iterator {
+
+    private:
+
+      const parser* _parser;                    // parser with the vertices
+      uint32_t _id;                          // identifier of the current vertex
+
+    public:
+
+      using iterator_category = forward_iterator_tag;
+      using value_type = vertex_ref;
+      using difference_type = ptrdiff_t;
+      using pointer = void;
+      using reference = vertex_ref;
+
+      // Explicit constructor
+      vertex_iterator (const parser* parser = nullptr, uint32_t id = 0)
+	: _parser {parser},
+	  _id {id}
+      {}
+
+      vertex_ref operator* () const
+      {
+	return {_id, _parser->_ids.get_name (_id),
+		_parser->get_neighbour_range (_id), _parser->_vertex[_id]};
+      }
+      vertex_iterator& operator++ ()
+      {
+	_id++;
+	return *this;
+      }
+      vertex_iterator operator++ (int)
+      {
+	vertex_iterator current {*this};
+	_id++;
+	return current;
+      }
+      bool operator== (const vertex_iterator& other) const
+      { return _id == other._id; }
+      bool operator!= (const vertex_iterator& other) const
+      { return _id != other._id; }
+    }; // class vertex_iterator
+
+    // Class definition
+    //
+    // Definition of an iterator over all edges of the graph, sorted by the
+    // identifier of their origin and then in the same order than the
+    // neighbours of every vertex
+    class edge_iterator {
+
+    private:
+
+      const parser* _parser;                       // parser with the edges
+      uint32_t _origin;                  // identifier of the current origin
+      size_t _position;        // position of the target among its neighbours
+
+      // skip all vertices with no more neighbours
+      void _skip ()
+      {
+	while (_origin < _parser->_graph.size () &&
+	       _position == _parser->_graph[_origin].size ()) {
+	  _origin++;
+	  _position = 0;
+	}
+      }
+
+    public:
+
+      using iterator_category = forward_iterator_tag;
+      using value_type = edge_ref;
+      using difference_type = ptrdiff_t;
+      using pointer = void;
+      using reference = edge_ref;
+
+      // Explicit constructor
+      edge_iterator (const parser* parser = nullptr, uint32_t origin = 0)
+	: _parser {parser},
+	  _origin {origin},
+	  _position {0}
+      {
+	if (_parser)
+	  _skip ();
+      }
+
+      edge_ref operator* () const
+      {
+	uint32_t target = _parser->_graph[_origin][_position];
+	return {_origin, target, _parser->_get_edge_attribute_map (_origin, target)};
+      }
+      edge_iterator& operator++ ()
+      {
+	_position++;
+	_skip ();
+	return *this;
+      }
+      edge_iterator operator++ (int)
+      {
+	edge_iterator current {*this};
+	++*this;
+	return current;
+      }
+      bool operator== (const edge_iterator& other) const
+      { return _origin == other._origin && _position == other._position; }
+      bool operator!= (const edge_iterator& other) const
+      { return !(*this == other); }
+    }; // class edge_iterator
+
   private:
 
     // INVARIANTS: every dot parser consists of a filename which is stored in a
     // private data member. The parser is responsible to process the contents of
-    // this file sequentially discanding those parts that are successfully
-    // processed
+    // this file sequentially. Contents are never copied: instead, a view over
+    // them is advanced past those parts that are successfully processed, so
+    // that the whole file is traversed only once
     string _filename;           // filename with the dot specification to parse
 
+    // INVARIANTS: if a cache directory is given, files are parsed only if no
+    // snapshot of their contents is found in it. Otherwise, the snapshot is
+    // restored instead, and snapshots are stored after parsing
+    string _cache;                   // directory with the cache of snapshots
+
+    // INVARIANTS: all the containers below take their memory from the same
+    // memory resource, either given by the user or an arena owned by this
+    // parser. The arena is monotonic, so that allocations are just increments
+    // of a pointer and deallocations do nothing: all memory is released at
+    // once when the parser is destroyed. The arena is shared with the parsers
+    // moved from this one, as the containers of a moved-from parser might
+    // still take memory from it
+    shared_ptr<pmr::monotonic_buffer_resource> _arena;   // default arena, if any
+
+    // INVARIANTS: if statistics are collected, all allocations are counted by
+    // a resource which takes the memory from the one given by the user or the
+    // arena above. Otherwise, no counter is created. As the arena, it is
+    // shared with the parsers moved from this one
+    shared_ptr<counting_resource> _counter;    // counter of allocations, if any
+    pmr::memory_resource* _resource;          // resource used by all containers
+
     // INVARIANTS: each graph has a type (either directed or undirected) and a
     // name (which can be the empty string). They are stored in dedicated data
     // members
-    string _type;                  // graph type, either directed or undirected
-    string _name;              // graph name which can be also the empty string
-
-    // graphs are represented like adjacency maps which are indexed by the
-    // vertex name given in the dot file. Each entry of the map consists then of
-    // a vector of adjacent vertices
-    map<string, vector<string>> _graph;
+    pmr::string _type;             // graph type, either directed or undirected
+    pmr::string _name;         // graph name which can be also the empty string
+
+    // INVARIANTS: every vertex is given a dense identifier, in the same order
+    // they are found in the dot file, so that the graph and the attributes of
+    // vertices and edges are stored in vectors indexed by the identifiers of
+    // the vertices. Names are then looked up only once per vertex given in the
+    // dot file
+    interner _ids;                          // identifiers of all vertex names
+
+    // graphs are represented like adjacency lists which are indexed by the
+    // vertex identifier. Each entry consists then of a vector with the
+    // identifiers of the adjacent vertices
+    pmr::vector<pmr::vector<uint32_t>> _graph;
+
+    // INVARIANTS: all edges of the graph are indexed with a key which consists
+    // of the identifier of the origin in the 32 most significant bits and the
+    // identifier of the target in the 32 least significant bits, so that
+    // duplicated edges are detected and edges are looked up in constant time,
+    // while the adjacency lists above preserve the order of the neighbours
+    pmr::unordered_set<uint64_t> _edges;                // index of all edges
 
     // graphs can contain an arbitrary collection of labels which must be given
     // a value. These are stored in the following data member
-    map<string, string> _label;
+    attribute_map _label;
     
     // each graph is made of vertices and edges which can be characterized with
-    // attributes. These are stored in a couple of maps:
+    // attributes. These are stored in a couple of vectors:
     //
-    //    _vertex stores for every vertex name a map of attributes of the form
+    //    _vertex stores for every vertex a map of attributes of the form
     //    "name"->"value"
-    //    _edge stores for every vertex name a map which is indexed with the
-    //    target vertex name and a map of attribute names and values.
+    //    _edge stores for every edge with attributes a map of attribute names
+    //    and values. It is indexed with the same keys used in _edges.
     //
-    // In both cases, though values can be casted into different types, they are
-    // internally stored as strings.
-    map<string,map<string,string>> _vertex;
-    map<string,map<string,map<string, string>>> _edge;
-
-    // Additionally, the user can explicitly request verbose output while
-    // parsing the dot specification file. It is disabled by default
-    bool _verbose;                     // whether the user wants verbose output
+    // In both cases, values are stored along with their number, if they are
+    // numbers, so that they can be retrieved with any type.
+    pmr::vector<attribute_map> _vertex;
+    pmr::unordered_map<uint64_t, attribute_map> _edge;
+
+    // the contents are read by a reader which notifies them to this parser
+    // (which is then its handler) and that keeps the contents that are fed
+    // but not read yet. When reading in parallel, notifications are recorded
+    // and replayed later
+    reader _reader;                            // reader of the dot contents
+    stats _stats;                  // statistics of the updates of the graph
+    friend class reader;
+    friend class recorder;
+
+    // snapshots of the graph are written directly from the containers above
+    friend class snapshot;
+
+    // graphs are also written in the DOT language directly from them
+    friend class writer;
     
   private:
 
-    // return in contents all the contents of the dot file stored in
-    // _filename. It returns true if the operation was successfully
-    // performed. Otherwise, it returns false
-    bool _read_file (string& contents) const;
-    
-    // the following methods parse different types according to the given
-    // regexp. The second and third methods return in value the matching of the
-    // given regexp.
-
-    // just simply parse a regular expression. It return true if the given
-    // string was parsed and false otherwise.
-    bool _parse_void (string& content, const string& regexp) const;
-
-    // parse a string and return its value in 'value' It return true if the
-    // given string was parsed and false otherwise.
-    bool _parse_string (string& content, const string& regexp, string& value) const;
-
-    // parse an unsigned int and return its value in 'value' It return true if
-    // the given string was parsed and false otherwise.
-    bool _parse_unsigned_int (string& content, const string& regexp, 
-			      unsigned int& value) const;
-
-    // skips the section of contents if it contains comments. It returns the
-    // contents that result after stripping the leading comments. It honors both
-    // C and C++ comments (as specified in the dot language)
-    void _parse_comments (string& contents) const;
-
-    // parse the given contents and if the specified regexp matches then its value
-    // is returned. Additionally, it is shown prefixed by a label on the standard
-    // output if and only if verbose is enabled
-    bool _read_string (string& contents, const string& regexp, string& value, const string& label) const;
-
-    // parse the given contents and return true if the given regexp
-    // matches. Additionally, it shows the given label if and only if verbose is
-    // enabled
-    bool _read_void (string& contents, const string& regexp, const string& label) const;
+    // parse the file given in the explicit constructor with the given number
+    // of threads, restoring it from the cache, if any, whenever it was parsed
+    // before
+    bool _parse_file (unsigned int nbthreads);
+
+    // make available in contents all the contents of the dot file stored in
+    // _filename. Regular files are mapped into memory rather than copied. It
+    // returns true if the operation was successfully performed. Otherwise, it
+    // returns false
+    bool _read_file (input& contents) const;
+
+    // return the identifier of the given vertex, which is added to the graph
+    // with no neighbours and no attributes if it was not found
+    uint32_t _get_vertex (string_view name);
+
+    // return the identifier of the vertex with the given name. In case no
+    // vertex is found with the given name an exception is raised
+    uint32_t _find_vertex (string_view name) const;
+
+    // return the key of the edge orig->target in the index of edges
+    static uint64_t _edge_key (uint32_t orig, uint32_t target)
+    { return (uint64_t (orig) << 32) | target; }
 
     // updates the contents of the graph adding the edge orig->target and, if
-    // the arc is undirected, it adds also the edge target->orig. Finally,
-    // because the list of vertices is computed from the matrix of adjacency,
-    // then target is added to the graph even if it has no neighbours.
-    void _update_graph (const string& orig_name, const string& edge_type, const string& target_name);
-    
-    // parse an attributes section. The attributes read are return as a map that
-    // stores for every attribute its value as a string. It returns true if any
-    // attributes were found and raises an exception otherwise
-    bool _process_attributes (string& contents, map<string, string>& dict) const;
-
-    // process the value of a label named labelid. This method should be invoked
-    // only when a label identifier has been found in contents which should then
-    // start with the value of the label. It returns true if it could
-    // successfully determine the label value and raises an exception otherwise
-    bool _process_label_value (string& contents, const string& labelid);
-
-    // process the attributes of an edge joining two single vertices, orig_name
-    // and target_name, of the specified type edge_type, given in arcdict. It
-    // also processes the attributes of the target vertex if any are given in
-    // contents. It returns true upon successful completion and false otherwise
-    bool _process_single_vertex (string& contents,
-				 const string& orig_name, const string& edge_type,
-				 const string& target_name, map<string, string> arcdict);
-  
-    // process a multiple declaration of target vertices which should appear
-    // right at the beginning of the specified contents. The original vertex,
-    // type of edge and any edge attributes specified previously should be given
-    // now in orig_name, edge_type and arcdict. It returns true if and only if
-    // the block could be successfully parsed and raises an exception otherwise
-    bool _process_multiple_vertices (string& contents, const string& orig_name,
-				     const string& edge_type, map<string, string>& arcdict);
-
-    // process a trajectory or path defined over single definitions of vertices
-    // from the origin vertex specified. It returns true upon successful
-    // completion of the trajectory and raises an exception otherwise
-    bool _process_trajectory (string& contents, string& orig_name);
+    // the arc is undirected, it adds also the edge target->orig.
+    void _update_graph (uint32_t orig, bool directed, uint32_t target);
+
+    // merge the given attributes into dict, so that the values already stored
+    // prevail. If an attribute is given more than once, the last value is
+    // taken
+    static void _merge (attribute_map& dict, const attributes& attrs);
+
+    // return a copy of the given attributes
+    static map<string, string> _copy (const attribute_map& attrs);
+
+    // add to the given table an empty column for every attribute in attrs
+    // which has none yet
+    static void _add_columns (columns& table, const attribute_map& attrs);
+
+    // return the value of the label with the specified name. In case no label
+    // is found with the given name an exception is raised
+    const value& _get_label (const string& name) const;
+
+    // return the value of an attribute defined for a specific vertex. In case
+    // no node is found with the given node, or no attribute with the given
+    // name is found for the specified node, an exception is raised
+    const value& _get_vertex_attribute (const string& name, const string& attrname) const;
+
+    // return the attributes of the edge (origin,target), or null if it has
+    // none. If either the origin does not exist, or the target is not found to
+    // be a neighbour of the origin, an exception is raised
+    const attribute_map* _get_edge (const string& origin, const string& target) const;
+
+    // return the attributes of the edge orig->target, which are empty if it
+    // has none. The edge is not verified to exist
+    const attribute_map& _get_edge_attribute_map (uint32_t orig, uint32_t target) const;
+
+    // return the value of the given attribute defined for the edge
+    // (origin,target). If either the origin does not exist, or the target is
+    // not found to be a neighbour of the origin, or the edge has attributes
+    // but none with the given name, an exception is raised. Edges with no
+    // attributes at all have an empty value for every attribute
+    const value& _get_edge_attribute (const string& origin, const string& target,
+				      const string& attrname) const;
+
+    // the following methods store the contents notified by the reader. Note
+    // that all of them merge the new contents with those already stored, so
+    // that the values given first prevail
+
+    // the header of the graph
+    void graph (string_view type, string_view name);
+
+    // a label with its value
+    void label (string_view name, string_view value);
+
+    // a node statement
+    void vertex (string_view name);
+
+    // the attributes of a vertex
+    void vertex_attributes (string_view name, const attributes& attrs);
+
+    // an edge, either directed or undirected
+    void edge (string_view orig, string_view target, bool directed);
+
+    // the attributes of an edge, which are annotated in both directions if the
+    // edge is undirected
+    void edge_attributes (string_view orig, string_view target, bool directed,
+			  const attributes& attrs);
     
   public:
 
     // Default constructor 
     parser ()
-      : _filename {""},
-	_verbose  {false}
+      : parser {"", nullptr}
     {}
     
     // Explicit constructor
     parser (const string& filename)
-      : _filename {filename}
+      : parser {filename, nullptr}
     { }
 
+    // Explicit constructors which take all memory from the given resource. If
+    // none is given, the parser creates its own monotonic arena
+    explicit parser (pmr::memory_resource* resource)
+      : parser {"", resource}
+    {}
+    parser (const string& filename, pmr::memory_resource* resource)
+      : _filename {filename},
+	_arena {resource ? nullptr : make_shared<pmr::monotonic_buffer_resource> ()},
+	_counter {stats::enabled ?
+		  make_shared<counting_resource> (resource ? resource : _arena.get ()) :
+		  nullptr},
+	_resource {_counter ? _counter.get () :
+		   resource ? resource : _arena.get ()},
+	_type {_resource},
+	_name {_resource},
+	_ids {_resource},
+	_graph {_resource},
+	_edges {_resource},
+	_label {_resource},
+	_vertex {_resource},
+	_edge {_resource}
+    {}
+
+    // parsers can be moved but neither copied nor assigned, as their containers
+    // refer to the memory resource given in their construction. The resources
+    // owned by a parser live as long as it or any parser moved from it
+    parser (const parser&) = delete;
+    parser (parser&& other)
+      : _filename {std::move (other._filename)},
+	_cache {std::move (other._cache)},
+	_arena {other._arena},
+	_counter {other._counter},
+	_resource {other._resource},
+	_type {std::move (other._type)},
+	_name {std::move (other._name)},
+	_ids {std::move (other._ids)},
+	_graph {std::move (other._graph)},
+	_edges {std::move (other._edges)},
+	_label {std::move (other._label)},
+	_vertex {std::move (other._vertex)},
+	_edge {std::move (other._edge)},
+	_reader {std::move (other._reader)},
+	_stats {std::move (other._stats)}
+    {}
+    parser& operator= (const parser&) = delete;
+    parser& operator= (parser&&) = delete;
+
     // get/set accessors
     string get_type () const
-    { return _type; }
+    { return string (_type); }
     string get_name () const
-    { return _name; }
+    { return string (_name); }
+    pmr::memory_resource* get_memory_resource () const
+    { return _counter ? _counter->get_upstream () : _resource; }
+    const string& get_cache () const
+    { return _cache; }
+
+    // use the given directory (which is created if it does not exist) as a
+    // cache of parsed files, or disable the cache if the directory is
+    // empty. Files are looked up in the cache by their path, and snapshots
+    // found are used only if the size, time of last modification and hash of
+    // the file are the same. In case the directory can not be created an
+    // exception is raised, but errors when writing in the cache are ignored
+    void set_cache (const string& directory);
 
     // get all labels of this graph
     vector<string> get_labels () const;
 
     // get the value of the label with the specified name
     string get_label_value (const string& name);
+
+    // get the value of the label with the specified name with the given type,
+    // either a string or an arithmetic type. Numbers are decoded only once,
+    // when they are parsed, and an exception is raised if an arithmetic type
+    // is requested for a value which is not a number
+    template<class T>
+    T get_label_value (const string& name) const
+    { return _get_label (name).get<T> (); }
     
     // get all source vertices of the graph
     vector<string> get_vertices () const;
@@ -209,6 +470,89 @@ namespace dot {
     // found with the given node an exception is raised.
     vector<string> get_neighbours (const string& name);
 
+    // get the number of vertices of the graph
+    size_t get_nb_vertices () const
+    { return _ids.size (); }
+
+    // get the identifier of the vertex with the given name. Identifiers are
+    // dense, i.e., they range from 0 to get_nb_vertices ()-1, and they are
+    // assigned in the same order vertices are found in the dot file. In case no
+    // vertex is found with the given name an exception is raised.
+    uint32_t get_vertex_id (string_view name) const
+    { return _find_vertex (name); }
+
+    // get the name of the vertex with the given identifier. In case no vertex
+    // is found with the given identifier an exception is raised.
+    string_view get_vertex_name (uint32_t id) const
+    { return _ids.get_name (id); }
+
+    // get the identifiers of all nodes that are reachable from the node with
+    // the given identifier. In case no vertex is found with the given
+    // identifier an exception is raised.
+    const pmr::vector<uint32_t>& get_neighbour_ids (uint32_t id) const
+    { return _graph.at (id); }
+
+    // the following services give access to the graph without copying
+    // anything, so that they take constant time and allocate no memory. The
+    // ranges and references they return are valid only while the graph is not
+    // modified
+
+    // get the identifiers of all nodes that are reachable from the node with
+    // the given identifier or name, in the same order than in
+    // get_neighbour_ids. In case no vertex is found an exception is raised.
+    range<const uint32_t*> get_neighbour_range (uint32_t id) const
+    {
+      const pmr::vector<uint32_t>& neighbours = _graph.at (id);
+      return {neighbours.data (), neighbours.data () + neighbours.size ()};
+    }
+    range<const uint32_t*> get_neighbour_range (string_view name) const
+    { return get_neighbour_range (_find_vertex (name)); }
+
+    // get all vertices of the graph, in increasing order of their identifiers
+    range<vertex_iterator> get_vertex_range () const
+    { return {vertex_iterator {this, 0}, vertex_iterator {this, uint32_t (_graph.size ())}}; }
+
+    // get all edges of the graph, sorted by the identifier of their origin and
+    // then in the same order than the neighbours of every vertex
+    range<edge_iterator> get_edge_range () const
+    { return {edge_iterator {this, 0}, edge_iterator {this, uint32_t (_graph.size ())}}; }
+
+    // get all labels of the graph
+    const attribute_map& get_label_map () const
+    { return _label; }
+
+    // get the attributes of the vertex with the given identifier. In case no
+    // vertex is found with the given identifier an exception is raised.
+    const attribute_map& get_vertex_attribute_map (uint32_t id) const
+    { return _vertex.at (id); }
+
+    // get the attributes of the edge orig->target, which are empty if it has
+    // none. If the target is not found to be a neighbour of the origin, an
+    // exception is raised.
+    const attribute_map& get_edge_attribute_map (uint32_t orig, uint32_t target) const
+    {
+      if (!_edges.count (_edge_key (orig, target)))
+	throw dot::syntax_error (" There is no edge from the node " + to_string (orig) + " to the node " + to_string (target));
+      return _get_edge_attribute_map (orig, target);
+    }
+
+    // return the graph in compressed sparse row format, where vertices are
+    // given the same identifiers used in this parser. It is built in one pass
+    // over the adjacency lists, and neighbours are stored in the same order
+    // than in get_neighbour_ids. In case the graph has more edges than
+    // numeric_limits<uint32_t>::max (), an invalid_argument exception is
+    // raised
+    csr get_csr () const;
+
+    // return the attributes of all vertices stored in columns, one per
+    // attribute name, where vertices are given the same identifiers used in
+    // this parser
+    columns get_vertex_columns () const;
+
+    // return the attributes of all edges stored in columns, one per attribute
+    // name, where edges are given the same indices than in get_csr
+    columns get_edge_columns () const;
+
     // get all attributes of all vertices of the graph
     map<string, map<string, string>> get_all_vertex_attributes () const;
     
@@ -221,6 +565,12 @@ namespace dot {
     // is found for the specified node, an exception is raised.
     string get_vertex_attribute (const string& name, const string& attrname);
 
+    // return the value of an attribute defined for a specific vertex with the
+    // given type, just like get_label_value<T> does
+    template<class T>
+    T get_vertex_attribute (const string& name, const string& attrname) const
+    { return _get_vertex_attribute (name, attrname).get<T> (); }
+
     // get the edge attributes for all edges in the graph that have any
     map<string, map<string, map<string, string>>> get_all_edge_attributes ();
     
@@ -236,18 +586,86 @@ namespace dot {
     // exception is raised.
     string get_edge_attribute (const string& origin, const string& target, const string& attrname);
 
-    // Sets the verbose level to true by default
+    // return the value of the given attribute defined for the edge qualified
+    // by (origin,target) names with the given type, just like
+    // get_label_value<T> does
+    template<class T>
+    T get_edge_attribute (const string& origin, const string& target, const string& attrname) const
+    { return _get_edge_attribute (origin, target, attrname).get<T> (); }
+
+    // Sets the verbose level to true by default. Tokens are then shown on the
+    // standard output, one per line preceded by their offset
     void set_verbose (bool value = true)
-    { _verbose = value; }
+    { _reader.set_verbose (value); }
+
+    // trace all tokens read with the given sink, or disable the trace if none
+    // is given. The sink is given the events in batches while parsing, and it
+    // must exist until the trace is disabled or the parser is destroyed.
+    // Traces are compiled out in release builds (i.e., if NDEBUG is defined)
+    void set_trace (trace_sink* sink)
+    { _reader.set_trace (sink); }
+
+    // return the statistics of all the contents parsed so far along with the
+    // memory allocated and the size of the graph. They are all zero unless
+    // DOT_STATS is defined
+    stats get_stats () const;
+
+    // reset the statistics of the parsing process. Note that neither the
+    // memory allocated nor the size of the graph are reset
+    void clear_stats ()
+    {
+      _reader.clear_stats ();
+      _stats = stats ();
+    }
+
+    // recover from syntax errors, or raise an exception with the first one
+    // (by default). In recovery mode, all syntax errors are recorded along
+    // with their offset, line and column, parsing resumes after the next
+    // statement terminator (i.e., the next semicolon or end of line) and all
+    // the statements successfully parsed are kept in the graph. Contents are
+    // then parsed sequentially even if many threads are requested
+    void set_recovery (bool value = true)
+    { _reader.set_recovery (value); }
+
+    // return the syntax errors recorded in recovery mode while parsing the
+    // last file or string, or all chunks fed so far, in the same order they
+    // appear in the contents
+    const vector<syntax_error>& get_errors () const
+    { return _reader.get_errors (); }
     
     // parse the file given in the explicit constructor of this instance. It
     // returns true if the file could be successfully parse. Otherwise, it
-    // raises an exception with an error message
+    // raises an exception with an error message or, in recovery mode, it
+    // returns false
     bool parse ();    
     
     // parse the given string. It returns true if the string could be successfully
-    // parse. Otherwise, it raises an exception with an error message
-    bool parse_string (string contents);    
+    // parse. Otherwise, it raises an exception with an error message or, in
+    // recovery mode, it returns false. The contents are not copied and need to
+    // exist only while being parsed
+    bool parse_string (string_view contents);    
+
+    // parse the file given in the explicit constructor of this instance or the
+    // given string just like the previous services do, but using the given
+    // number of threads (all those available if zero). The graph is precisely
+    // the same than when parsing sequentially
+    bool parse (unsigned int nbthreads);
+    bool parse_string (string_view contents, unsigned int nbthreads);
+
+    // parse the given chunk of contents, which are appended to those given in
+    // previous invocations. Statements are parsed as soon as they are known to
+    // be complete, so that only the last incomplete statement is kept in
+    // memory. Syntax errors are reported as soon as no contents given later
+    // could fix them, and at the latest by finish ()
+    void feed (const char* data, size_t size);
+
+    // parse all the contents which are still pending after feeding the last
+    // chunk. It returns true if the graph was successfully parsed. Otherwise,
+    // it raises an exception with an error message or, in recovery mode, it
+    // returns false. In any case, the next chunk fed (also after an exception
+    // is raised by feed) starts another graph, which is added to this one just
+    // like parse_string does
+    bool finish ();
     
   };  // class parser
   
@@ -0,0 +1,94 @@
+/*
+  DOTrange.h
+  Description: Ranges of elements which are not copied
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 16:47:55 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	RANGE_H_
+# define   	RANGE_H_
+
+// A range is a pair of iterators over elements stored elsewhere, so that it is
+// obtained in constant time and without allocating memory. Ranges over
+// contiguous elements (i.e., whose iterators are pointers) can be also
+// indexed, as spans.
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a range of elements given by two iterators
+  template<class Iterator>
+  class range {
+
+  private:
+
+    // INVARIANTS: the range consists of the elements in [_first, _last). They
+    // must exist while the range is used
+    Iterator _first;                                   // first element
+    Iterator _last;                                      // past the last element
+
+  public:
+
+    // Default constructor, which creates an empty range
+    range ()
+      : _first {},
+	_last {}
+    {}
+
+    // Explicit constructor
+    range (Iterator first, Iterator last)
+      : _first {first},
+	_last {last}
+    {}
+
+    // get accessors
+    Iterator begin () const
+    { return _first; }
+    Iterator end () const
+    { return _last; }
+
+    // return the number of elements in this range
+    size_t size () const
+    { return size_t (distance (_first, _last)); }
+
+    // return true if this range has no elements
+    bool empty () const
+    { return _first == _last; }
+
+    // return the i-th element of this range, which is not verified
+    decltype (auto) operator[] (size_t i) const
+    { return *next (_first, i); }
+
+    // return the i-th element of this range. In case it does not exist an
+    // exception is raised
+    decltype (auto) at (size_t i) const
+    {
+      if (i >= size ())
+	throw out_of_range ("no element has the index " + to_string (i));
+      return *next (_first, i);
+    }
+
+  }; // class range
+
+} // namespace dot
+
+#endif 	    /* !RANGE_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
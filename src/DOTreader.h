@@ -0,0 +1,1352 @@
+/*
+  DOTreader.h
+  Description: Event-driven reader of the dot language
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 16:21:09 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	READER_H_
+# define   	READER_H_
+
+// The reader recognizes the statements of the dot language and notifies them
+// to a handler as they are found, in the same order they appear in the
+// contents, without storing them. Handlers are given as template parameters
+// so that all notifications are resolved (and usually inlined) at compile
+// time. The dot parser itself is just a handler which stores the graph in
+// maps.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "DOTdefs.h"
+#include "DOThandler.h"
+#include "DOTlexer.h"
+#include "DOTrecorder.h"
+#include "DOTstats.h"
+#include "DOTthreads.h"
+#include "DOTtrace.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Struct definition
+  //
+  // Definition of a syntax error exception. Errors found while reading are
+  // located in the contents, with both lines and columns starting at one. The
+  // line of errors which are not located is zero
+  struct syntax_error : public exception {
+
+    string _msg;                                        // syntax error message
+    uint64_t _offset;          // offset of the error from the first byte read
+    size_t _line;                                      // line of the error
+    size_t _column;                                  // column of the error
+
+    explicit syntax_error (const string& msg)
+      : _msg { msg },
+	_offset { 0 },
+	_line { 0 },
+	_column { 0 }
+    {}
+
+    // get accessors
+    uint64_t get_offset () const
+    { return _offset; }
+    size_t get_line () const
+    { return _line; }
+    size_t get_column () const
+    { return _column; }
+
+    virtual const char * what () const throw () {
+      return _msg.c_str ();
+    }
+  };
+
+  // Class definition
+  //
+  // Definition of a dot reader
+  class reader {
+
+  private:
+
+    // INVARIANTS: contents can be also given incrementally in chunks. Those
+    // which have not been read yet are kept in _pending, and _stage records
+    // which part of the graph is expected next. Only whole statements are
+    // read, so that _pending never contains more than the last (incomplete)
+    // statement and the contents that follow it. Once the graph is finished,
+    // the reader is ready to read another one
+    enum class stage : unsigned char { header, body, end };
+    stage _stage;                            // next part of the graph to read
+    string _pending;                          // contents fed but not read yet
+
+    // INVARIANTS: the statement at the beginning of _pending is scanned,
+    // without notifying anything, to know whether it can be read. The scan
+    // stops right before the first token which might be continued by the
+    // contents fed later, and it is resumed there once more contents are
+    // fed, so that every byte is scanned only once: _scan records
+    // the number of characters of the statement already scanned, what is
+    // expected next (and after the attributes, if any, which are expected) and
+    // whether an edge or a block with multiple vertices was already found
+    enum class expect : unsigned char { statement, label_value, node_end, edge,
+					target, block, end, attributes,
+					attribute_name, attribute_value,
+					attribute_next_end, attribute_last_end };
+    struct scan {
+      expect _next;                                 // what is expected next
+      expect _resume;                       // what is expected after attributes
+      size_t _position;                   // number of characters scanned
+      bool _edge;                                // whether an edge was found
+      bool _block;                       // whether a block was found
+    } _scan;                                       // scan of the next statement
+
+    // the attributes of vertices and edges are collected in the following
+    // containers, which are reused among statements to avoid allocating memory
+    attributes _vertex_attrs;                    // attributes of the last vertex
+    attributes _edge_attrs;                        // attributes of the last edge
+
+    // Additionally, the user can explicitly request a trace of the tokens
+    // read, either given to a sink of its own or shown on the standard output
+    // if verbose output is requested. It is disabled by default
+    mutable tracer _tracer;                          // tracer of the tokens read
+    unique_ptr<trace_sink> _verbose;          // sink of verbose output, if any
+
+    // INVARIANTS: positions in the contents are computed with respect to
+    // _base, which is at _origin bytes from the first byte read (also when
+    // contents are fed in chunks), in the line _lines + 1 which starts at
+    // _line_start bytes from the first byte read. Lines are counted only up
+    // to the positions requested, i.e., only when errors are found or
+    // contents fed are removed
+    const char* _base;                       // location of a known position
+    uint64_t _origin;                                        // offset of _base
+    size_t _lines;                                 // number of lines before _base
+    uint64_t _line_start;                 // offset of the line of _base
+
+    // INVARIANTS: in recovery mode, syntax errors are recorded in _errors,
+    // and reading resumes after the next statement terminator instead of
+    // raising an exception
+    bool _recovery;                             // whether errors are recovered
+    vector<syntax_error> _errors;                   // syntax errors recorded
+
+    // INVARIANTS: statistics of all the contents read so far are collected
+    // only if DOT_STATS is defined. They are updated from const services as
+    // well, as they do not change what is read
+    mutable stats _stats;                             // statistics collected
+
+  private:
+
+    // the following methods parse the different tokens recognized by the
+    // lexer. The second one returns in value the first group of the regexp
+    // defining the token in DOTdefs.h. All of them advance the view given in
+    // content past the match if any is found and leave it untouched
+    // otherwise. Note that the token is given as a template parameter so that
+    // the right matcher is selected at compile time
+
+    // just simply parse a token. It return true if the given string was parsed
+    // and false otherwise.
+    template<token T>
+    bool _parse_void (string_view& content) const
+    {
+      string_view value;
+      size_t length = lexer::match<T> (content, value);
+      if (length != lexer::npos) {                  // in case a match was found
+	content.remove_prefix (length);                 // move past the match
+	DOT_STATS_RUN (_stats.tokens[size_t (T)]++);
+	return true;                                 // and return with success
+      }
+      return false;                              // otherwise exit with failure
+    }
+
+    // parse a token and return its value in 'value' It return true if the
+    // given string was parsed and false otherwise. Note that the value is a
+    // view over the given contents
+    template<token T>
+    bool _parse_string (string_view& content, string_view& value) const
+    {
+      size_t length = lexer::match<T> (content, value);
+      if (length != lexer::npos) {                  // in case a match was found
+	content.remove_prefix (length);                 // move past the match
+	DOT_STATS_RUN (_stats.tokens[size_t (T)]++);
+	return true;                                 // and return with success
+      }
+      return false;                              // otherwise exit with failure
+    }
+
+    // skips the section of contents if it contains comments. It honors both C
+    // and C++ comments (as specified in the dot language)
+    void _parse_comments (string_view& contents) const
+    {
+      DOT_STATS_PHASE (_stats, phase::comments);
+
+      // both types of comments are acknowledged by the lexer. The key question
+      // is that there might be an arbitrary number of comments one following
+      // the other at the beginning of contents
+      while (_parse_void<token::cpp_comment> (contents));
+    }
+
+    // parse the given contents and if the specified token matches then its
+    // value is returned. Additionally, it is traced along with the given
+    // label
+    template<token T>
+    bool _read_string (string_view& contents, string_view& value, string_view label) const
+    {
+      _parse_comments (contents);
+      if (_parse_string<T> (contents, value))
+	DOT_TRACE (_tracer.emit (T, value.data (), label, value));
+      else
+	return false;
+      return true;
+    }
+
+    // parse the given contents and return true if the given token
+    // matches. Additionally, it is traced along with the given label
+    template<token T>
+    bool _read_void (string_view& contents, string_view label) const
+    {
+      _parse_comments (contents);
+      if (_parse_void<T> (contents))
+	DOT_TRACE (_tracer.emit (T, contents.data () - 1, label, {}));
+      else
+	return false;
+      return true;
+    }
+
+    // remove the double quotes of the given value, if they were given
+    static string_view _unquote (string_view value)
+    {
+      if (value.size () >= 2 && value.front () == '"' && value.back () == '"')
+	return value.substr (1, value.size () - 2);
+      return value;
+    }
+
+    // start computing positions with respect to the given location, which is
+    // the first byte read
+    void _start (const char* base)
+    {
+      _base = base;
+      _origin = _lines = _line_start = 0;
+    }
+
+    // compute positions with respect to the given location from now on, which
+    // can not precede _base, counting the lines in between
+    void _advance (const char* location)
+    {
+      for (const char* p = _base ; p != location ; p++)
+	if (*p == '\n') {
+	  _lines++;
+	  _line_start = _origin + (p - _base) + 1;
+	}
+      _origin += location - _base;
+      _base = location;
+    }
+
+    // locate the given error at the first character of the given contents
+    // which is not blank, which can not precede _base
+    void _locate (syntax_error& error, string_view contents)
+    {
+      size_t blanks = contents.find_first_not_of (" \t\n\r\v\f");
+      _advance (contents.data () + (blanks == string_view::npos ? contents.size () : blanks));
+      error._offset = _origin;
+      error._line = _lines + 1;
+      error._column = _origin - _line_start + 1;
+    }
+
+    // skip the statement at the beginning of the given contents up to its
+    // terminator, i.e., past the next semicolon or end of line, or right
+    // before the next closing curly bracket. Blanks and comments preceding the
+    // statement are skipped first
+    void _resync (string_view& contents) const
+    {
+      _parse_comments (contents);
+      size_t blanks = contents.find_first_not_of (" \t\n\r\v\f");
+      contents.remove_prefix (blanks == string_view::npos ? contents.size () : blanks);
+      size_t end = contents.find_first_of (";\n}");
+      if (end == string_view::npos)
+	contents.remove_prefix (contents.size ());
+      else
+	contents.remove_prefix (end + (contents[end] != '}'));
+    }
+
+    // return true if the terminator of the statement at the beginning of the
+    // given contents is found, i.e., if _resync would skip it all
+    bool _is_terminated (string_view contents) const
+    {
+      _parse_comments (contents);
+      size_t blanks = contents.find_first_not_of (" \t\n\r\v\f");
+      return blanks != string_view::npos &&
+	contents.find_first_of (";\n}", blanks) != string_view::npos;
+    }
+
+    // return true if the given contents consist only of blanks and comments
+    bool _is_blank (string_view contents) const
+    {
+      _parse_comments (contents);
+      return contents.find_first_not_of (" \t\n\r\v\f") == string_view::npos;
+    }
+
+    // parse an attributes section. The attributes read are returned in attrs
+    // in the same order they are given. It returns true if any attributes
+    // were found and raises an exception otherwise
+    bool _process_attributes (string_view& contents, attributes& attrs) const;
+
+    // process the value of a label named labelid. This method should be invoked
+    // only when a label identifier has been found in contents which should then
+    // start with the value of the label. It returns true if it could
+    // successfully determine the label value and raises an exception otherwise
+    template<class Handler>
+    bool _process_label_value (string_view& contents, string_view labelid, Handler& handler);
+
+    // process the edge joining two single vertices, orig_name and target_name,
+    // with the attributes given in _edge_attrs. It also processes the
+    // attributes of the target vertex if any are given in contents. It returns
+    // true upon successful completion and false otherwise
+    template<class Handler>
+    bool _process_single_vertex (string_view& contents,
+				 string_view orig_name, bool directed,
+				 string_view target_name, Handler& handler);
+
+    // process a multiple declaration of target vertices which should appear
+    // right at the beginning of the specified contents. The original vertex
+    // and type of edge should be given now in orig_name and directed, and any
+    // edge attributes specified previously in _edge_attrs. It returns true if
+    // and only if the block could be successfully parsed and raises an
+    // exception otherwise
+    template<class Handler>
+    bool _process_multiple_vertices (string_view& contents, string_view orig_name,
+				     bool directed, Handler& handler);
+
+    // process a trajectory or path defined over single definitions of vertices
+    // from the origin vertex specified. It returns true upon successful
+    // completion of the trajectory and raises an exception otherwise
+    template<class Handler>
+    bool _process_trajectory (string_view& contents, string_view orig_name, Handler& handler);
+
+    // process the header of a graph, i.e., its type and name, and the
+    // beginning of its block. It returns true upon successful completion and
+    // raises an exception otherwise
+    template<class Handler>
+    bool _process_header (string_view& contents, Handler& handler);
+
+    // process the next statement of the block of a graph. It returns true if
+    // a statement was processed and false if the block is closed instead. In
+    // case of error, an exception is raised
+    template<class Handler>
+    bool _process_statement (string_view& contents, Handler& handler);
+
+    // process the next statement of the block of a graph just like the
+    // previous service does. In recovery mode, syntax errors are recorded
+    // instead, and the rest of the statement is skipped. If the block is not
+    // closed, an error is recorded and false is returned
+    template<class Handler>
+    bool _recover_statement (string_view& contents, Handler& handler);
+
+    // record the given error located in the given contents
+    void _record (syntax_error error, string_view contents)
+    {
+      _locate (error, contents);
+      _errors.push_back (move (error));
+    }
+
+    // advance the given text past the token T and return true if it matches
+    template<token T>
+    static bool _skip (string_view& text)
+    {
+      string_view value;
+      size_t length = lexer::match<T> (text, value);
+      if (length == lexer::npos)
+	return false;
+      text.remove_prefix (length);
+      return true;
+    }
+
+    // return true if the statement at the beginning of the given contents can
+    // be read, i.e., if it is known to be complete or to have a syntax error
+    // that no contents given later can fix. The scan is resumed where it
+    // stopped the last time. No notification is issued
+    bool _is_complete (string_view contents);
+
+    // read as many whole statements of the pending contents as possible and
+    // remove them. Unless final is true, the last statement is read only if
+    // it is known to be complete or to have a syntax error that no contents
+    // given later can fix. If final is true, all pending contents are read.
+    // Syntax errors raise exceptions, unless in recovery mode
+    template<class Handler>
+    void _process_pending (bool final, Handler& handler);
+
+    // forget all the contents fed, so that the next chunk is read as the
+    // beginning of another graph
+    void _reset ()
+    {
+      _stage = stage::header;
+      _pending.clear ();
+      _scan = scan ();
+      _origin = _lines = _line_start = 0;
+    }
+
+    // INVARIANTS: when reading in parallel, the block of the graph is split in
+    // chunks which are read by different threads. Every chunk records the
+    // notifications of all the statements that start in it, along with their
+    // location in the block and the location where the first of their
+    // notifications is recorded. Reading stops either after the last
+    // statement that starts in the chunk, or when the block is closed, or when
+    // a statement can not be read
+    struct chunk {
+      size_t _begin;                      // location where the chunk starts
+      size_t _limit;           // location where the next chunk starts
+      vector<size_t> _starts;        // location where every statement starts
+      vector<size_t> _marks;   // first notification of every statement
+      size_t _stop;                // location where reading stopped
+      bool _closed;           // whether the block is closed at _stop
+      recorder _notifications;               // notifications of all statements
+    };
+
+    // read all the statements which start in the given chunk of the block
+    // and record their notifications. Syntax errors are not reported, as the
+    // chunk might not start at the beginning of a statement
+    void _process_chunk (string_view block, chunk& chunk);
+
+    // read statements of the block sequentially, starting at the location
+    // given in position and notifying them to the given handler, until either
+    // the given limit is reached or the block is closed. The location where
+    // reading stopped is returned in position. It returns false if the block
+    // was closed and true otherwise. In case of error, an exception is raised
+    template<class Handler>
+    bool _process_block (string_view block, size_t& position, size_t limit, Handler& handler);
+
+  public:
+
+    // Default constructor
+    reader ()
+      : _stage {stage::header},
+	_scan {},
+	_base {nullptr},
+	_origin {0},
+	_lines {0},
+	_line_start {0},
+	_recovery {false}
+    {}
+
+    // Sets the verbose level to true by default. Tokens are then shown on the
+    // standard output, one per line preceded by their offset
+    void set_verbose (bool value = true)
+    {
+      auto sink = value ? make_unique<stream_sink> (cout) : nullptr;
+      _tracer.set_sink (sink.get ());
+      _verbose = move (sink);
+    }
+
+    // trace all tokens read with the given sink, or disable the trace if none
+    // is given. Traces are compiled out in release builds (i.e., if NDEBUG is
+    // defined), in which case no events are given to the sink
+    void set_trace (trace_sink* sink)
+    {
+      _tracer.set_sink (sink);
+      _verbose.reset ();
+    }
+
+    // get the statistics of all the contents read so far. They are all zero
+    // unless DOT_STATS is defined
+    const stats& get_stats () const
+    { return _stats; }
+
+    // reset the statistics collected so far
+    void clear_stats ()
+    { _stats = stats (); }
+
+    // recover from syntax errors, or raise an exception with the first one
+    // (by default). In recovery mode, all syntax errors are recorded along
+    // with their location, and reading resumes after the next statement
+    // terminator, i.e., the next semicolon or end of line. Contents are then
+    // read sequentially even if many threads are requested
+    void set_recovery (bool value = true)
+    { _recovery = value; }
+
+    // return the syntax errors recorded in recovery mode while reading the
+    // last string, or all chunks fed so far, in the same order they appear in
+    // the contents
+    const vector<syntax_error>& get_errors () const
+    { return _errors; }
+
+    // read the given string notifying its contents to the given handler. It
+    // returns true if the string could be successfully read. Otherwise, it
+    // raises an exception with an error message or, in recovery mode, it
+    // returns false. The contents are not copied and need to exist only while
+    // being read
+    template<class Handler>
+    bool parse_string (string_view contents, Handler& handler);
+
+    // read the given string just like the previous service does, but using
+    // the given number of threads (all those available if zero). The block of
+    // the graph is split in chunks which are read in parallel, and the
+    // notifications of all its statements are then issued in the same order
+    // they appear in the contents, so that the handler receives precisely
+    // the same notifications than when reading sequentially. If tokens
+    // are traced, the contents are read sequentially
+    template<class Handler>
+    bool parse_string (string_view contents, Handler& handler, unsigned int nbthreads);
+
+    // read the given chunk of contents, which are appended to those given in
+    // previous invocations, notifying them to the given handler. Statements
+    // are notified as soon as they are known to be complete, so that only the
+    // last incomplete statement is kept in memory. Syntax errors are reported
+    // as soon as no contents given later could fix them, and at the latest by
+    // finish ()
+    template<class Handler>
+    void feed (const char* data, size_t size, Handler& handler);
+
+    // read all the contents which are still pending after feeding the last
+    // chunk. It returns true if the graph was successfully read. Otherwise, it
+    // raises an exception with an error message or, in recovery mode, it
+    // returns false. In any case, the next chunk fed (also after an exception
+    // is raised by feed) starts another graph
+    template<class Handler>
+    bool finish (Handler& handler);
+
+  }; // class reader
+
+  // Private services
+  // --------------------------------------------------------------------------
+
+  // parse an attributes section. The attributes read are returned in attrs in
+  // the same order they are given. It returns true if any attributes were found
+  // and raises an exception otherwise
+  inline bool reader::_process_attributes (string_view& contents, attributes& attrs) const
+  {
+    DOT_STATS_PHASE (_stats, phase::attributes);
+    attrs.clear ();
+
+    // check if the current contents start with an attributes section
+    if (_parse_void<token::attribute_begin> (contents)) {
+
+      bool eoattr = false;
+      while (!eoattr) {
+
+	string_view attrname, attrvalue;
+
+	// yeah, an attributes section is started, so process it. Start getting
+	// the name of the next attribute
+	if (_parse_string<token::attribute_name> (contents, attrname))
+	  DOT_TRACE (_tracer.emit (token::attribute_name, attrname.data (), "\tATTRIBUTE", attrname));
+	else
+	  throw dot::syntax_error ("an ATTRIBUTE_NAME could not be parsed");
+
+	// try first to read the value of this attribute followed by and end
+	// of attribute section (']')
+	if ((eoattr = _parse_string<token::attribute_value_end> (contents, attrvalue))) {
+
+	  // Make sure to remove the double quotes in case they were given
+	  attrvalue = _unquote (attrvalue);
+	  DOT_TRACE (_tracer.emit (token::attribute_value_end, attrvalue.data (),
+				   "\tVALUE (*)", attrvalue));
+
+	  // store the last read pair
+	  attrs.emplace_back (attrname, attrvalue);
+	}
+
+	// otherwise, read the next value followed by a comma
+	else if (_parse_string<token::attribute_value_next> (contents, attrvalue)) {
+
+	  // Make sure to remove the double quotes in case they were given
+	  attrvalue = _unquote (attrvalue);
+	  DOT_TRACE (_tracer.emit (token::attribute_value_next, attrvalue.data (),
+				   "\tVALUE", attrvalue));
+
+	  // store the last read pair
+	  attrs.emplace_back (attrname, attrvalue);
+	}
+
+	// if neither the attribute section is finished nor it is continued
+	// with other assignments, then an error should be raise
+	else
+	  throw dot::syntax_error ("an ATTRIBUTE_VALUE could not be parsed");
+
+	// check anyway if the attributes section gets closed here (this is
+	// good, e.g., for preventing empty attributes sections)
+	eoattr = _parse_void<token::attribute_end> (contents) || eoattr;
+      }
+      DOT_STATS_RUN (_stats.peak_attributes = max (_stats.peak_attributes, attrs.size ()));
+
+      // and return that an attribute section was successfully processed
+      return true;
+    }
+
+    // at this point, no attribute section was processed
+    return false;
+  }
+
+  // process the value of a label named labelid. This method should be invoked
+  // only when a label identifier has been found in contents which should then
+  // start with the value of the label. It returns true if it could
+  // successfully determine the label value and raises an exception otherwise
+  template<class Handler>
+  bool reader::_process_label_value (string_view& contents, string_view labelid, Handler& handler)
+  {
+
+    string_view label_value;
+    if (!_read_string<token::label_value> (contents, label_value, "LABEL VALUE"))
+      throw dot::syntax_error ("it was not possible to read a LABEL_VALUE");
+
+    // if a value could be successfully processed for this label, then notify
+    // it. Make sure to remove the double quotes in case they were given
+    handler.label (labelid, _unquote (label_value));
+    return true;
+  }
+
+  // process the edge joining two single vertices, orig_name and target_name,
+  // with the attributes given in _edge_attrs. It also processes the attributes
+  // of the target vertex if any are given in contents. It returns true upon
+  // successful completion and false otherwise
+  template<class Handler>
+  bool reader::_process_single_vertex (string_view& contents,
+				       string_view orig_name, bool directed,
+				       string_view target_name, Handler& handler)
+  {
+
+    // first, notify the edge and its attributes if and only if any were given
+    handler.edge (orig_name, target_name, directed);
+    if (_edge_attrs.size ())
+      handler.edge_attributes (orig_name, target_name, directed, _edge_attrs);
+
+    // and process also this vertex attributes, if given
+    if (_process_attributes (contents, _vertex_attrs))
+      handler.vertex_attributes (target_name, _vertex_attrs);
+
+    return true;
+  }
+
+  // process a multiple declaration of target vertices which should appear right
+  // at the beginning of the specified contents. The original vertex and type of
+  // edge should be given now in orig_name and directed, and any edge attributes
+  // specified previously in _edge_attrs. It returns true if and only if the
+  // block could be successfully parsed and raises an exception otherwise
+  template<class Handler>
+  bool reader::_process_multiple_vertices (string_view& contents, string_view orig_name,
+					   bool directed, Handler& handler)
+  {
+
+    DOT_STATS_PHASE (_stats, phase::multiple_vertices);
+    string_view target_name;
+
+    // Multiple targets consist of an arbitrarily large list of vertices
+    // between curly brackets
+    if (_parse_void<token::block_begin> (contents)) {
+      DOT_TRACE (_tracer.emit (token::block_begin, contents.data () - 1,
+			       " --- Beginning multiple target specification ---", {}));
+      bool eomts = false;           // end of multiple target specification
+      while (!eomts) {
+
+	// unless the multiple target specification is over
+	_parse_comments (contents);
+	if (!(eomts=_parse_void<token::block_end> (contents))) {
+
+	  // get the next vertex name
+	  if (!_read_string<token::vertex_name> (contents, target_name, "TARGET VERTEX"))
+	    throw dot::syntax_error ("TARGET_NAME could not be parsed");
+
+	  // and process the edge to this vertex, along with its attributes and,
+	  // if given, the attributes of the target vertex as well
+	  _process_single_vertex (contents, orig_name, directed, target_name, handler);
+	}
+      }
+      DOT_TRACE (_tracer.emit (token::block_end, contents.data () - 1,
+			       " --- Ending multiple target specification ---", {}));
+    }
+    else
+      throw dot::syntax_error ("a block with a declaration of multiple vertices could not be parsed");
+
+    return true;
+  }
+
+  // process a trajectory or path defined over single definitions of vertices
+  // from the origin vertex specified which, however, could be terminated with a
+  // block with multiple vertices. It returns true upon successful completion of
+  // the trajectory and raises an exception otherwise
+  template<class Handler>
+  bool reader::_process_trajectory (string_view& contents, string_view orig_name, Handler& handler)
+  {
+
+    string_view edge_type;
+    string_view target_name;
+    int pathlength = 0;
+
+    // in case a block with multiple vertices is found, it is necessary to
+    // enable the following flag to ensure that no edges follow it
+    bool block_found = false;
+
+    // while an edge is found in contents
+    while (_read_string<token::edge_type> (contents, edge_type, "EDGE TYPE")) {
+
+      // first of all, if an edge follows a block with multiple vertices then a
+      // syntax error should be raised
+      if (block_found)
+	throw dot::syntax_error ("an edge was found immediately after a block with multiple vertices");
+
+      // yeah! A path is listed, parse the attributes of this edge if any were
+      // given
+      bool directed = (edge_type == "->");
+      _process_attributes (contents, _edge_attrs);
+
+      // get the target vertex of this specific edge
+      if (!_read_string<token::vertex_name> (contents, target_name, "TARGET VERTEX")) {
+
+	// if a target vertex could not be retrieved, then the only option is
+	// that a block with multiple vertices is declared, but we should make
+	// sure that this is the last part of the statement so that no edges can
+	// follow it
+	_process_multiple_vertices (contents, orig_name, directed, handler);
+	block_found = true;
+      }
+      else {
+
+	// and process this edge along with its attributes and also the
+	// attributes of the target vertex if any were given
+	_process_single_vertex (contents, orig_name, directed, target_name, handler);
+      }
+
+      // and now make the
+      orig_name = target_name;
+
+      // and increment the path length
+      pathlength++;
+    }
+
+    // if no edge was found, then raise a syntax error
+    if (!pathlength)
+      throw dot::syntax_error ("no EDGE_TYPE has been provided");
+
+    // otherwise leave gracefully
+    return true;
+  }
+
+  // process the header of a graph, i.e., its type and name, and the beginning
+  // of its block. It returns true upon successful completion and raises an
+  // exception otherwise
+  template<class Handler>
+  bool reader::_process_header (string_view& contents, Handler& handler)
+  {
+
+    // get the graph type
+    // REMARK - "strict" is not acknowledged!
+    string_view type, name;
+    if (!_read_string<token::graph_type> (contents, type, "TYPE"))
+      throw dot::syntax_error ("GRAPH type could not be parsed");
+
+    // get the graph name
+    // REMARK - the graph name is entirely optional
+    if (!_read_string<token::graph_name> (contents, name, "NAME"))
+      throw dot::syntax_error ("NAME could not be parsed");
+
+    // block start
+    if (!_read_void<token::block_begin> (contents, "--- Block begin found ---"))
+      throw dot::syntax_error ("BEGIN OF BLOCK missing");
+
+    handler.graph (type, name);
+    return true;
+  }
+
+  // process the next statement of the block of a graph. It returns true if a
+  // statement was processed and false if the block is closed instead. In case
+  // of error, an exception is raised
+  template<class Handler>
+  bool reader::_process_statement (string_view& contents, Handler& handler)
+  {
+
+    // unless we are closing the block at this point
+    _parse_comments (contents);
+    if (_parse_void<token::block_end> (contents)) {
+      DOT_TRACE (_tracer.emit (token::block_end, contents.data () - 1,
+			       " --- Block end found ---", {}));
+      return false;
+    }
+    DOT_STATS_RUN (_stats.nb_statements++);
+
+    // at the beginning of each line we could have either a vertex name, or a
+    // label. Try first, reading a label
+    string_view orig_name;
+    if (_read_string<token::label_assignment> (contents, orig_name, "LABEL ID")) {
+
+      // if a label was found, then retrieve its value and notify it
+      _process_label_value (contents, orig_name, handler);
+
+      // this completes the processing of a single statement, consume the
+      // semicolon in case it has been given
+      _parse_comments (contents);
+      _parse_void<token::end_of_statement> (contents);
+      return true;
+    }
+    else
+      if (!_read_string<token::vertex_name> (contents, orig_name, "SOURCE_VERTEX"))
+	throw dot::syntax_error ("neither a VERTEX_NAME nor a LABEL_ID have been provided");
+
+    // and process also its attributes
+    if (_process_attributes (contents, _vertex_attrs))
+      handler.vertex_attributes (orig_name, _vertex_attrs);
+
+    // at this point, the statement could be over if it is a "node statement",
+    // i.e., a node along with its attributes. In this case, the statement
+    // should be ended with a semicolon
+    _parse_comments (contents);
+    if (_parse_void<token::end_of_statement> (contents)) {
+
+      // if so, just notify this vertex and proceed with the next line
+      handler.vertex (orig_name);
+      return true;
+    }
+
+    // and now process the entire trajectory from this original vertex
+    _process_trajectory (contents, orig_name, handler);
+
+    // this completes the processing of a single statement, consume the
+    // semicolon in case it has been given
+    _parse_comments (contents);
+    _parse_void<token::end_of_statement> (contents);
+    return true;
+  }
+
+  // process the next statement of the block of a graph just like
+  // _process_statement does. In recovery mode, syntax errors are recorded
+  // instead, and the rest of the statement is skipped. If the block is not
+  // closed, an error is recorded and false is returned
+  template<class Handler>
+  bool reader::_recover_statement (string_view& contents, Handler& handler)
+  {
+    if (!_recovery)
+      return _process_statement (contents, handler);
+
+    // note that the block can not be closed once all contents are read
+    if (_is_blank (contents)) {
+      _record (syntax_error ("BLOCK END missing"), contents);
+      contents.remove_prefix (contents.size ());
+      return false;
+    }
+    try {
+      return _process_statement (contents, handler);
+    } catch (const dot::syntax_error& error) {
+      _record (error, contents);
+      _resync (contents);
+    }
+    return true;
+  }
+
+  // return true if the statement at the beginning of the given contents can be
+  // read, i.e., if it is known to be complete or to have a syntax error that no
+  // contents given later can fix. The scan is resumed where it stopped the last
+  // time. No notification is issued
+  //
+  // The statement is scanned token by token just as _process_statement reads
+  // it. A token can be matched (or not) only once it is known to end before
+  // the contents fed so far: names, numbers and operators once another
+  // character follows them, and quoted strings once the line is over, as they
+  // extend up to the last double quote in the same line. The assignments and
+  // values of attributes, which can span several lines, are checked instead
+  // with the lexer. The scan stops right before the first token that can not
+  // be matched yet
+  inline bool reader::_is_complete (string_view contents)
+  {
+    string_view text = contents.substr (_scan._position);
+
+    // return true if only blanks remain in the text, after skipping all
+    // comments if required. Comments which are not over yet are blanks
+    auto blank = [&text] (bool comments) {
+      if (comments)
+	while (_skip<token::cpp_comment> (text));
+      size_t first = text.find_first_not_of (" \t\n\r\v\f");
+      if (first == string_view::npos)
+	return true;
+      string_view rest = text.substr (first);
+      return comments && rest[0] == '/' && (rest.size () == 1 || rest[1] == '/') &&
+	rest.find ('\n') == string_view::npos;
+    };
+
+    // return true if the next token ends before the end of the text
+    auto settled = [&text] () {
+      size_t first = text.find_first_not_of (" \t\n\r\v\f");
+      if (text[first] == '"')
+	return text.find ('\n', first) != string_view::npos;
+      return text.find_first_not_of ("0123456789abcdefghijklmnopqrstuvwxyz"
+				     "ABCDEFGHIJKLMNOPQRSTUVWXYZ_.+-", first) != string_view::npos;
+    };
+
+    while (true) {
+
+      // the scan is always resumed right before the next token
+      _scan._position = text.data () - contents.data ();
+      switch (_scan._next) {
+
+      // a statement starts either with the end of the block, a label or a
+      // vertex, which is optionally followed by its attributes
+      case expect::statement:
+	if (blank (true) || lexer::is_prefix<token::label_assignment> (text) || !settled ())
+	  return false;
+	if (_skip<token::block_end> (text))
+	  return true;
+	if (_skip<token::label_assignment> (text))
+	  _scan._next = expect::label_value;
+	else if (_skip<token::vertex_name> (text)) {
+	  _scan._next = expect::attributes;
+	  _scan._resume = expect::node_end;
+	}
+	else
+	  return true;
+	break;
+      case expect::label_value:
+	if (blank (true) || !settled ())
+	  return false;
+	if (!_skip<token::label_value> (text))
+	  return true;
+	_scan._next = expect::end;
+	break;
+
+      // node statements are ended with a semicolon. Otherwise, a trajectory
+      // follows, which consists of edges (with their attributes) to targets,
+      // either single vertices (with their attributes) or blocks of multiple
+      // vertices, which can not be followed by other edges
+      case expect::node_end:
+	if (blank (true) || !settled ())
+	  return false;
+	if (_skip<token::end_of_statement> (text))
+	  return true;
+	_scan._next = expect::edge;
+	break;
+      case expect::edge:
+	if (blank (true) || !settled ())
+	  return false;
+	if (_skip<token::edge_type> (text)) {
+	  if (_scan._block)
+	    return true;
+	  _scan._next = expect::attributes;
+	  _scan._resume = expect::target;
+	}
+	else if (!_scan._edge)
+	  return true;
+	else
+	  _scan._next = expect::end;
+	break;
+      case expect::target:
+	if (blank (true) || !settled ())
+	  return false;
+	_scan._edge = true;
+	if (_skip<token::vertex_name> (text)) {
+	  _scan._next = expect::attributes;
+	  _scan._resume = expect::edge;
+	}
+	else if (_skip<token::block_begin> (text))
+	  _scan._next = expect::block;
+	else
+	  return true;
+	break;
+      case expect::block:
+	if (blank (true) || !settled ())
+	  return false;
+	if (_skip<token::block_end> (text)) {
+	  _scan._block = true;
+	  _scan._next = expect::edge;
+	}
+	else if (_skip<token::vertex_name> (text)) {
+	  _scan._next = expect::attributes;
+	  _scan._resume = expect::block;
+	}
+	else
+	  return true;
+	break;
+
+      // the statement is complete, with or without a semicolon
+      case expect::end:
+	if (blank (true))
+	  return false;
+	return true;
+
+      // attributes are optional and, if given, they consist of a list of
+      // assignments between square brackets
+      case expect::attributes:
+	if (blank (false))
+	  return false;
+	_scan._next = _skip<token::attribute_begin> (text) ? expect::attribute_name : _scan._resume;
+	break;
+      case expect::attribute_name:
+	if (lexer::is_prefix<token::attribute_name> (text))
+	  return false;
+	if (!_skip<token::attribute_name> (text))
+	  return true;
+	_scan._next = expect::attribute_value;
+	break;
+      case expect::attribute_value:
+	if (_skip<token::attribute_value_end> (text))
+	  _scan._next = expect::attribute_last_end;
+	else if (_skip<token::attribute_value_next> (text))
+	  _scan._next = expect::attribute_next_end;
+	else
+	  return !lexer::is_prefix<token::attribute_value_end> (text);
+	break;
+      case expect::attribute_next_end:
+      case expect::attribute_last_end:
+	if (blank (false))
+	  return false;
+	if (_skip<token::attribute_end> (text))
+	  _scan._next = _scan._resume;
+	else
+	  _scan._next = (_scan._next == expect::attribute_last_end) ?
+	    _scan._resume : expect::attribute_name;
+	break;
+      }
+    }
+  }
+
+  // read as many whole statements of the pending contents as possible and
+  // remove them. Unless final is true, the last statement is read only if it
+  // is known to be complete or to have a syntax error that no contents given
+  // later can fix. If final is true, all pending contents are read. Syntax
+  // errors raise exceptions, unless in recovery mode
+  template<class Handler>
+  void reader::_process_pending (bool final, Handler& handler)
+  {
+
+    // the header is notified only once it has been completely read, so that
+    // it is just read again if it is incomplete, i.e., if nothing but blanks
+    // follow the token that could not be read. Note that it is read over a
+    // copy of the view which is committed only upon success, and the same
+    // happens with its trace. Comments preceding it are skipped only once,
+    // and the header is not read until either its block or its line is
+    // started, so that none of its tokens can be continued later
+    _base = _pending.data ();
+    DOT_TRACE (_tracer.set_origin (_base, _origin));
+    string_view parsed {_pending};
+    if (_stage == stage::header) {
+      _parse_comments (parsed);
+      size_t first = parsed.find_first_not_of (" \t\n\r\v\f");
+      string_view next = parsed;
+      DOT_TRACE (size_t mark = _tracer.mark ());
+      try {
+	if (final || (first != string_view::npos &&
+		      parsed.find_first_of (parsed[first] == '/' ? "\n" : "{\n", first) != string_view::npos)) {
+	  _process_header (next, handler);
+	  _stage = stage::body;
+	  parsed = next;
+	}
+      } catch (dot::syntax_error& error) {
+	if (!final && _is_blank (next)) {
+	  DOT_TRACE (_tracer.rollback (mark));
+	}
+	else {
+
+	  // in recovery mode, nothing else is read if the header is wrong
+	  DOT_TRACE (_tracer.flush ());
+	  _locate (error, next);
+	  if (!_recovery)
+	    throw;
+	  _errors.push_back (error);
+	  _stage = stage::end;
+	  parsed.remove_prefix (parsed.size ());
+	}
+      }
+    }
+
+    // statements are notified until either all of them are read, or the next
+    // one can not be read yet. The trace is given to its sink before the
+    // contents it refers to are removed, even in case of error
+    try {
+      while (_stage == stage::body) {
+
+	// in recovery mode, the rest of a wrong statement is skipped up to its
+	// terminator, which has to be fed already
+	if (!final && (!_is_complete (parsed) || (_recovery && !_is_terminated (parsed))))
+	  break;
+	_scan = scan ();
+	if (!_recover_statement (parsed, handler))
+	  _stage = stage::end;
+      }
+    } catch (dot::syntax_error& error) {
+      DOT_TRACE (_tracer.flush ());
+      _locate (error, parsed);
+      throw;
+    } catch (...) {
+      DOT_TRACE (_tracer.flush ());
+      throw;
+    }
+    DOT_TRACE (_tracer.flush ());
+
+    // and remove all the contents which were successfully read, counting
+    // their lines
+    size_t length = parsed.data () - _pending.data ();
+    _advance (parsed.data ());
+    _pending.erase (0, length);
+  }
+
+  // read all the statements which start in the given chunk of the block and
+  // record their notifications. Syntax errors are not reported, as the chunk
+  // might not start at the beginning of a statement
+  inline void reader::_process_chunk (string_view block, chunk& chunk)
+  {
+
+    chunk._closed = false;
+    string_view contents = block.substr (chunk._begin);
+    size_t position = chunk._begin;
+    try {
+
+      // read statements until one starts past the limit of this chunk
+      while (position < chunk._limit) {
+	chunk._starts.push_back (position);
+	chunk._marks.push_back (chunk._notifications.size ());
+	if (!_process_statement (contents, chunk._notifications)) {
+	  chunk._closed = true;
+	  break;
+	}
+	position = block.size () - contents.size ();
+      }
+    } catch (const dot::syntax_error&) {
+
+      // if the last statement could not be read, then all its notifications
+      // are removed and reading stops before it
+      chunk._notifications.truncate (chunk._marks.back ());
+    }
+
+    // the last statement was read only if reading stopped past the limit
+    if (position < chunk._limit) {
+      chunk._starts.pop_back ();
+      chunk._marks.pop_back ();
+    }
+    chunk._marks.push_back (chunk._notifications.size ());
+    chunk._stop = position;
+  }
+
+  // read statements of the block sequentially, starting at the location given
+  // in position and notifying them to the given handler, until either the
+  // given limit is reached or the block is closed. The location where reading
+  // stopped is returned in position. It returns false if the block was closed
+  // and true otherwise. In case of error, an exception is raised
+  template<class Handler>
+  bool reader::_process_block (string_view block, size_t& position, size_t limit, Handler& handler)
+  {
+    string_view contents = block.substr (position);
+    try {
+      while (position < limit) {
+	if (!_process_statement (contents, handler))
+	  return false;
+	position = block.size () - contents.size ();
+      }
+    } catch (dot::syntax_error& error) {
+      _locate (error, contents);
+      throw;
+    }
+    return true;
+  }
+
+  // Public services
+  // --------------------------------------------------------------------------
+
+  // read the given string notifying its contents to the given handler. It
+  // returns true if the string could be successfully read. Otherwise, it raises
+  // an exception with an error message or, in recovery mode, it returns false
+  //
+  // The given contents are traversed only once with a view that is advanced
+  // past every token successfully processed, so that reading takes linear time
+  // in the size of the contents
+  template<class Handler>
+  bool reader::parse_string (string_view contents, Handler& handler)
+  {
+
+    // process the header of the graph and then all statements in its
+    // block. The trace is given to its sink at the end, even in case of error
+    DOT_STATS_RUN (_stats.bytes += contents.size ());
+    DOT_TRACE (_tracer.set_origin (contents.data (), 0));
+    _start (contents.data ());
+    _errors.clear ();
+    try {
+      _process_header (contents, handler);
+      while (_recover_statement (contents, handler));
+    } catch (dot::syntax_error& error) {
+
+      // errors are located only once they are found. In recovery mode, only
+      // errors in the header get here, and nothing else is read then
+      DOT_TRACE (_tracer.flush ());
+      _locate (error, contents);
+      if (!_recovery)
+	throw;
+      _errors.push_back (error);
+    } catch (...) {
+      DOT_TRACE (_tracer.flush ());
+      throw;
+    }
+    DOT_TRACE (_tracer.flush ());
+
+    return _errors.empty ();                                   // nicely return
+  }
+
+  // read the given string just like the previous service does, but using the
+  // given number of threads (all those available if zero). The block of the
+  // graph is split in chunks which are read in parallel, and the notifications
+  // of all its statements are then issued in the same order they appear in the
+  // contents, so that the handler receives precisely the same notifications
+  // than when reading sequentially. If tokens are traced, the contents are
+  // read sequentially
+  //
+  // Chunks start at the beginning of lines, which are not necessarily the
+  // beginning of statements. However, statements are read independently of
+  // each other, so that the notifications of any statement are the same
+  // regardless of where reading started. Thus, starting at the beginning of
+  // the block, the notifications of every chunk are issued from the statement
+  // that starts where the previous chunk stopped. Only if no such statement
+  // was read in a chunk (e.g., because it started in the middle of a comment),
+  // the statements which start in it are read again sequentially
+  template<class Handler>
+  bool reader::parse_string (string_view contents, Handler& handler, unsigned int nbthreads)
+  {
+
+    if (!nbthreads)
+      nbthreads = max (1u, thread::hardware_concurrency ());
+    if (nbthreads == 1 || _tracer.is_active () || _recovery)
+      return parse_string (contents, handler);
+    DOT_STATS_RUN (_stats.bytes += contents.size ());
+
+    // process the header of the graph, so that the block starts right after it
+    _start (contents.data ());
+    try {
+      _process_header (contents, handler);
+    } catch (dot::syntax_error& error) {
+      _locate (error, contents);
+      throw;
+    }
+    string_view block = contents;
+
+    // split the block in a few chunks per thread, so that threads which read
+    // short statements can read other chunks. All chunks but the first one
+    // start at the beginning of a line
+    size_t nbchunks = 4 * nbthreads;
+    vector<chunk> chunks (nbchunks);
+    for (size_t i = 0 ; i < nbchunks ; i++) {
+      size_t begin = i * (block.size () / nbchunks);
+      if (i) {
+	begin = block.find ('\n', max (begin, chunks[i-1]._begin));
+	begin = (begin == string_view::npos) ? block.size () : begin + 1;
+      }
+      chunks[i]._begin = begin;
+      if (i)
+	chunks[i-1]._limit = begin;
+    }
+    chunks.back ()._limit = block.size ();
+
+    // read all chunks in parallel. Every thread takes the next chunk which
+    // has not been read yet. Exceptions other than syntax errors (e.g., when
+    // running out of memory) are raised once all threads are over
+    atomic<size_t> next {0};
+    vector<exception_ptr> errors (nbthreads);
+    DOT_STATS_RUN (vector<stats> partial (nbthreads));
+    auto work = [&] (unsigned int id) {
+      reader worker;
+      try {
+	for (size_t i = next++ ; i < nbchunks ; i = next++)
+	  worker._process_chunk (block, chunks[i]);
+      } catch (...) {
+	errors[id] = current_exception ();
+	next = nbchunks;
+      }
+      DOT_STATS_RUN (partial[id] = worker._stats);
+    };
+    thread_group threads;
+    for (unsigned int id = 1 ; id < nbthreads ; id++)
+      threads.spawn (work, id);
+    work (0);
+    threads.join ();
+    DOT_STATS_RUN (for (auto& worker : partial) _stats += worker);
+    for (auto& error : errors)
+      if (error)
+	rethrow_exception (error);
+
+    // and now issue all notifications in the same order than the statements
+    // in the contents, starting at the beginning of the block
+    size_t position = 0;
+    for (auto& chunk : chunks) {
+
+      // in case this chunk is already covered by the previous ones, skip it
+      if (position >= chunk._limit)
+	continue;
+
+      // if a statement was read starting at the current location, then issue
+      // the notifications of all the statements that follow it
+      auto istart = lower_bound (chunk._starts.begin (), chunk._starts.end (), position);
+      if (istart != chunk._starts.end () && *istart == position) {
+	chunk._notifications.replay (chunk._marks[istart - chunk._starts.begin ()],
+				     chunk._marks.back (), handler);
+	position = chunk._stop;
+      }
+      if (chunk._closed && position == chunk._stop)
+	return true;
+
+      // otherwise, read the rest of the chunk sequentially. Note that syntax
+      // errors are then reported precisely as when reading sequentially
+      if (!_process_block (block, position, chunk._limit, handler))
+	return true;
+    }
+
+    // finally, make sure that the block is closed
+    _process_block (block, position, string_view::npos, handler);
+    return true;
+  }
+
+  // read the given chunk of contents, which are appended to those given in
+  // previous invocations, notifying them to the given handler. Statements are
+  // notified as soon as they are known to be complete, so that only the last
+  // incomplete statement is kept in memory. Syntax errors are reported as soon
+  // as no contents given later could fix them, and at the latest by finish ()
+  template<class Handler>
+  void reader::feed (const char* data, size_t size, Handler& handler)
+  {
+
+    // contents following the end of the block are ignored (though counted) as
+    // in parse_string, and the errors of the previous graph are forgotten once
+    // another one is started
+    DOT_STATS_RUN (_stats.bytes += size);
+    if (_stage == stage::end)
+      return;
+    if (_stage == stage::header && _pending.empty () && !_origin)
+      _errors.clear ();
+    _pending.append (data, size);
+    DOT_STATS_RUN (_stats.peak_pending = max (_stats.peak_pending, _pending.size ()));
+
+    // in case of error, the rest of the graph can not be read
+    try {
+      _process_pending (false, handler);
+    } catch (...) {
+      _reset ();
+      throw;
+    }
+  }
+
+  // read all the contents which are still pending after feeding the last
+  // chunk. It returns true if the graph was successfully read. Otherwise, it
+  // raises an exception with an error message or, in recovery mode, it returns
+  // false. In any case, the next chunk fed starts another graph
+  template<class Handler>
+  bool reader::finish (Handler& handler)
+  {
+    try {
+      _process_pending (true, handler);
+    } catch (...) {
+      _reset ();
+      throw;
+    }
+    _reset ();
+    return _errors.empty ();
+  }
+
+} // namespace dot
+
+#endif 	    /* !READER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
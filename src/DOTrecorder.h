@@ -0,0 +1,153 @@
+/*
+  DOTrecorder.h
+  Description: Handler which records notifications to replay them later
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 09:14:52 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	RECORDER_H_
+# define   	RECORDER_H_
+
+// A recorder is a handler of the reader which stores all notifications it
+// receives, so that they can be replayed later to any other handler in
+// precisely the same order. Names and values are stored as views, so that the
+// contents being read must exist while the notifications are replayed.
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "DOThandler.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a handler which records all notifications
+  class recorder : public handler {
+
+  private:
+
+    // every notification is recorded with its type, the names (or values) it
+    // was given and, in case it has attributes, the location of the first one
+    // in _attributes and how many were given
+    enum class event : unsigned char { graph, label, vertex, vertex_attributes,
+				       edge, edge_attributes };
+    struct notification {
+      event _event;                                   // type of notification
+      bool _directed;                           // whether the edge is directed
+      string_view _first;        // graph type, label, vertex or edge origin
+      string_view _second;           // graph name, label value or edge target
+      size_t _first_attr;            // location of the first attribute, if any
+      uint32_t _nb_attrs;                     // number of attributes, if any
+    };
+
+    // INVARIANTS: notifications are stored in the same order they are
+    // received, and the attributes of all of them are stored in a single vector
+    vector<notification> _notifications;          // notifications received
+    attributes _attributes;                 // attributes of all notifications
+
+    // record a notification with the given attributes
+    void _record (event type, string_view first, string_view second,
+		  bool directed, const attributes& attrs)
+    {
+      _notifications.push_back ({type, directed, first, second,
+				 _attributes.size (), uint32_t (attrs.size ())});
+      _attributes.insert (_attributes.end (), attrs.begin (), attrs.end ());
+    }
+
+  public:
+
+    // the following methods record the notifications of the reader
+    void graph (string_view type, string_view name)
+    { _notifications.push_back ({event::graph, false, type, name, 0, 0}); }
+    void label (string_view name, string_view value)
+    { _notifications.push_back ({event::label, false, name, value, 0, 0}); }
+    void vertex (string_view name)
+    { _notifications.push_back ({event::vertex, false, name, string_view (), 0, 0}); }
+    void vertex_attributes (string_view name, const attributes& attrs)
+    { _record (event::vertex_attributes, name, string_view (), false, attrs); }
+    void edge (string_view orig, string_view target, bool directed)
+    { _notifications.push_back ({event::edge, directed, orig, target, 0, 0}); }
+    void edge_attributes (string_view orig, string_view target, bool directed,
+			  const attributes& attrs)
+    { _record (event::edge_attributes, orig, target, directed, attrs); }
+
+    // return the number of notifications recorded
+    size_t size () const
+    { return _notifications.size (); }
+
+    // remove all notifications recorded after the first n ones
+    void truncate (size_t n)
+    {
+      if (n < _notifications.size ()) {
+	_attributes.resize (_notifications[n]._first_attr);
+	_notifications.resize (n);
+      }
+    }
+
+    // remove all notifications
+    void clear ()
+    {
+      _notifications.clear ();
+      _attributes.clear ();
+    }
+
+    // notify the given handler all the notifications recorded in the range
+    // [first, last) in the same order they were received
+    template<class Handler>
+    void replay (size_t first, size_t last, Handler& handler) const
+    {
+      attributes attrs;
+      for (size_t i = first ; i < last ; i++) {
+	const notification& n = _notifications[i];
+	switch (n._event) {
+	case event::graph:
+	  handler.graph (n._first, n._second);
+	  break;
+	case event::label:
+	  handler.label (n._first, n._second);
+	  break;
+	case event::vertex:
+	  handler.vertex (n._first);
+	  break;
+	case event::vertex_attributes:
+	  attrs.assign (_attributes.begin () + n._first_attr,
+			_attributes.begin () + n._first_attr + n._nb_attrs);
+	  handler.vertex_attributes (n._first, attrs);
+	  break;
+	case event::edge:
+	  handler.edge (n._first, n._second, n._directed);
+	  break;
+	case event::edge_attributes:
+	  attrs.assign (_attributes.begin () + n._first_attr,
+			_attributes.begin () + n._first_attr + n._nb_attrs);
+	  handler.edge_attributes (n._first, n._second, n._directed, attrs);
+	  break;
+	}
+      }
+    }
+
+    // notify the given handler all the notifications recorded
+    template<class Handler>
+    void replay (Handler& handler) const
+    { replay (0, _notifications.size (), handler); }
+
+  }; // class recorder
+
+} // namespace dot
+
+#endif 	    /* !RECORDER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,237 @@
+/*
+  DOTscan.cc
+  Description: Classification scans used by the lexer
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 11:40:05 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <stdexcept>
+
+#include "DOTscan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+# define DOT_SCAN_X86
+# include <immintrin.h>
+#endif
+
+// Kernels
+// ----------------------------------------------------------------------------
+
+namespace {
+
+  // scalar kernels. They are used by all the other kernels to process the last
+  // characters which do not fill a whole register
+  const char* scalar_spaces (const char* p, const char* end)
+  {
+    while (p != end && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+      p++;
+    return p;
+  }
+
+  const char* scalar_identifier (const char* p, const char* end)
+  {
+    while (p != end && ((*p >= '0' && *p <= '9') || (*p >= 'a' && *p <= 'z') ||
+			(*p >= 'A' && *p <= 'Z') || *p == '_'))
+      p++;
+    return p;
+  }
+
+  const char* scalar_quote (const char* p, const char* end)
+  {
+    while (p != end && *p != '"')
+      p++;
+    return p;
+  }
+
+#ifdef DOT_SCAN_X86
+
+  // all vectorized kernels classify characters using only comparisons for
+  // equality and, to check whether c belongs to the range [lo, lo+n], the
+  // unsigned comparison min (c-lo, n) == c-lo. They compute a mask with the
+  // characters which do not belong to the class being scanned, and return the
+  // first one if any is found
+
+  // SSE2 kernels
+  __attribute__ ((target ("sse2")))
+  inline __m128i sse2_in_range (__m128i chunk, char lo, char n)
+  {
+    __m128i offset = _mm_sub_epi8 (chunk, _mm_set1_epi8 (lo));
+    return _mm_cmpeq_epi8 (_mm_min_epu8 (offset, _mm_set1_epi8 (n)), offset);
+  }
+
+  __attribute__ ((target ("sse2")))
+  const char* sse2_spaces (const char* p, const char* end)
+  {
+    for ( ; end - p >= 16 ; p += 16) {
+      __m128i chunk = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (p));
+      __m128i in = _mm_or_si128 (_mm_cmpeq_epi8 (chunk, _mm_set1_epi8 (' ')),
+				 sse2_in_range (chunk, '\t', '\r' - '\t'));
+      unsigned int mask = ~_mm_movemask_epi8 (in) & 0xffff;
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return scalar_spaces (p, end);
+  }
+
+  __attribute__ ((target ("sse2")))
+  const char* sse2_identifier (const char* p, const char* end)
+  {
+    for ( ; end - p >= 16 ; p += 16) {
+      __m128i chunk = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (p));
+      __m128i lower = _mm_or_si128 (chunk, _mm_set1_epi8 (0x20));
+      __m128i in = _mm_or_si128 (_mm_or_si128 (sse2_in_range (chunk, '0', 9),
+					       sse2_in_range (lower, 'a', 25)),
+				 _mm_cmpeq_epi8 (chunk, _mm_set1_epi8 ('_')));
+      unsigned int mask = ~_mm_movemask_epi8 (in) & 0xffff;
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return scalar_identifier (p, end);
+  }
+
+  __attribute__ ((target ("sse2")))
+  const char* sse2_quote (const char* p, const char* end)
+  {
+    for ( ; end - p >= 16 ; p += 16) {
+      __m128i chunk = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (p));
+      unsigned int mask = _mm_movemask_epi8 (_mm_cmpeq_epi8 (chunk, _mm_set1_epi8 ('"')));
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return scalar_quote (p, end);
+  }
+
+  // AVX2 kernels
+  __attribute__ ((target ("avx2")))
+  inline __m256i avx2_in_range (__m256i chunk, char lo, char n)
+  {
+    __m256i offset = _mm256_sub_epi8 (chunk, _mm256_set1_epi8 (lo));
+    return _mm256_cmpeq_epi8 (_mm256_min_epu8 (offset, _mm256_set1_epi8 (n)), offset);
+  }
+
+  __attribute__ ((target ("avx2")))
+  const char* avx2_spaces (const char* p, const char* end)
+  {
+    for ( ; end - p >= 32 ; p += 32) {
+      __m256i chunk = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p));
+      __m256i in = _mm256_or_si256 (_mm256_cmpeq_epi8 (chunk, _mm256_set1_epi8 (' ')),
+				    avx2_in_range (chunk, '\t', '\r' - '\t'));
+      unsigned int mask = ~static_cast<unsigned int> (_mm256_movemask_epi8 (in));
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return sse2_spaces (p, end);
+  }
+
+  __attribute__ ((target ("avx2")))
+  const char* avx2_identifier (const char* p, const char* end)
+  {
+    for ( ; end - p >= 32 ; p += 32) {
+      __m256i chunk = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p));
+      __m256i lower = _mm256_or_si256 (chunk, _mm256_set1_epi8 (0x20));
+      __m256i in = _mm256_or_si256 (_mm256_or_si256 (avx2_in_range (chunk, '0', 9),
+						     avx2_in_range (lower, 'a', 25)),
+				    _mm256_cmpeq_epi8 (chunk, _mm256_set1_epi8 ('_')));
+      unsigned int mask = ~static_cast<unsigned int> (_mm256_movemask_epi8 (in));
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return sse2_identifier (p, end);
+  }
+
+  __attribute__ ((target ("avx2")))
+  const char* avx2_quote (const char* p, const char* end)
+  {
+    for ( ; end - p >= 32 ; p += 32) {
+      __m256i chunk = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p));
+      unsigned int mask = _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (chunk, _mm256_set1_epi8 ('"')));
+      if (mask)
+	return p + __builtin_ctz (mask);
+    }
+    return sse2_quote (p, end);
+  }
+
+#endif // DOT_SCAN_X86
+}
+
+// Static data members
+// ----------------------------------------------------------------------------
+
+// scalar kernels are used until the best ones are selected
+dot::scanner::kernels dot::scanner::_kernels = {scalar_spaces, scalar_identifier, scalar_quote};
+dot::scanner::isa dot::scanner::_isa = dot::scanner::isa::scalar;
+
+namespace {
+
+  // select the best kernels supported by this CPU when this module is loaded
+  [[maybe_unused]] const bool selected = (dot::scanner::set_isa (dot::scanner::get_best_isa ()), true);
+}
+
+// Private services
+// ----------------------------------------------------------------------------
+
+// return the kernels of the given instruction set
+dot::scanner::kernels dot::scanner::_get_kernels (isa level)
+{
+  switch (level) {
+#ifdef DOT_SCAN_X86
+  case isa::avx2:
+    return {avx2_spaces, avx2_identifier, avx2_quote};
+  case isa::sse2:
+    return {sse2_spaces, sse2_identifier, sse2_quote};
+#endif
+  default:
+    return {scalar_spaces, scalar_identifier, scalar_quote};
+  }
+}
+
+// Public services
+// ----------------------------------------------------------------------------
+
+// return the best instruction set supported by this CPU
+dot::scanner::isa dot::scanner::get_best_isa ()
+{
+#ifdef DOT_SCAN_X86
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    return isa::avx2;
+  if (__builtin_cpu_supports ("sse2"))
+    return isa::sse2;
+#endif
+  return isa::scalar;
+}
+
+// use the kernels of the given instruction set. If it is not supported by this
+// CPU an exception is raised
+void dot::scanner::set_isa (isa level)
+{
+  if (level > get_best_isa ())
+    throw invalid_argument ("the instruction set '" + get_isa_name (level) +
+			    "' is not supported");
+  _kernels = _get_kernels (level);
+  _isa = level;
+}
+
+// return a textual description of the given instruction set
+std::string dot::scanner::get_isa_name (isa level)
+{
+  switch (level) {
+  case isa::avx2:
+    return "avx2";
+  case isa::sse2:
+    return "sse2";
+  default:
+    return "scalar";
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
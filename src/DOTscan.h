@@ -0,0 +1,122 @@
+/*
+  DOTscan.h
+  Description: Classification scans used by the lexer
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 11:40:05 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	SCAN_H_
+# define   	SCAN_H_
+
+// The hot loops of the lexer skip runs of characters of the same class:
+// blanks ([[:space:]]), identifiers ([0-9a-zA-Z_]) and the contents of quoted
+// strings (up to the closing double quote). This module provides kernels for
+// these scans which process 16 (SSE2) or 32 (AVX2) characters at once. The
+// best kernels supported by the CPU are selected at run time, and a scalar
+// version is always available as a fallback.
+
+#include <string>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of the scanner. It consists only of static services
+  class scanner {
+
+  public:
+
+    // instruction sets for which kernels are available. They are sorted in
+    // increasing order of performance
+    enum class isa : unsigned char { scalar, sse2, avx2 };
+
+    // the following services scan characters from p up to (but not including)
+    // end and return a pointer to the first character which does not belong
+    // to the class being scanned, or end if all do
+
+    // [[:space:]]*
+    static const char* spaces (const char* p, const char* end)
+    {
+
+      // most runs of blanks are really short (if any), so check them first
+      // before paying for a call to the kernel
+      if (p == end || !_is_space (*p))
+	return p;
+      return _kernels.spaces (p + 1, end);
+    }
+
+    // [0-9a-zA-Z_]*
+    static const char* identifier (const char* p, const char* end)
+    {
+      if (p == end || !_is_ident (*p))
+	return p;
+      return _kernels.identifier (p + 1, end);
+    }
+
+    // [^"]*
+    static const char* quote (const char* p, const char* end)
+    {
+      if (p == end || *p == '"')
+	return p;
+      return _kernels.quote (p + 1, end);
+    }
+
+    // return the instruction set of the kernels currently in use
+    static isa get_isa ()
+    { return _isa; }
+
+    // return the best instruction set supported by this CPU
+    static isa get_best_isa ();
+
+    // use the kernels of the given instruction set. If it is not supported by
+    // this CPU an exception is raised. This is intended mainly for testing and
+    // benchmarking
+    static void set_isa (isa level);
+
+    // return a textual description of the given instruction set
+    static string get_isa_name (isa level);
+
+  private:
+
+    // the kernels of an instruction set are stored in the following table
+    struct kernels {
+      const char* (*spaces) (const char* p, const char* end);
+      const char* (*identifier) (const char* p, const char* end);
+      const char* (*quote) (const char* p, const char* end);
+    };
+
+    // kernels currently in use and their instruction set. Note that they are
+    // initialized with the scalar version so that they can be safely used even
+    // before the best kernels are selected
+    static kernels _kernels;
+    static isa _isa;
+
+    // return the kernels of the given instruction set
+    static kernels _get_kernels (isa level);
+
+    // the following are the very same character classes used in the lexer
+    static bool _is_space (char c)
+    { return c == ' ' || (c >= '\t' && c <= '\r'); }
+    static bool _is_ident (char c)
+    {
+      return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+	(c >= 'A' && c <= 'Z') || c == '_';
+    }
+  }; // class scanner
+
+} // namespace dot
+
+#endif 	    /* !SCAN_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,596 @@
+/*
+  DOTsnapshot.cc
+  Description: Binary snapshots of parsed graphs
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 12:41:09 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <unordered_map>
+
+#include "DOTsnapshot.h"
+
+namespace {
+
+  using namespace std;
+
+  // return the given size rounded up to a multiple of 8
+  uint64_t align (uint64_t size)
+  { return (size + 7) & ~uint64_t (7); }
+
+  // write the given bytes into the stream, padded with zeros to a multiple of
+  // 8. If no data is given, only the padding is written
+  void write_section (ofstream& stream, const void* data, uint64_t size)
+  {
+    static const char padding[8] = {};
+    if (data)
+      stream.write (static_cast<const char*> (data), size);
+    stream.write (padding, align (size) - size);
+  }
+}
+
+// Private services
+// ----------------------------------------------------------------------------
+
+// return the size in bytes of the given section of a snapshot with the given
+// header
+uint64_t dot::snapshot::_get_section_size (const header& header, section s)
+{
+  switch (s) {
+  case string_offsets:
+    return sizeof (uint64_t) * (uint64_t (header._nb_strings) + 1);
+  case string_bytes:
+    return header._nb_chars;
+  case labels:
+    return sizeof (uint32_t) * 2 * uint64_t (header._nb_labels);
+  case vertex_names:
+  case vertex_order:
+    return sizeof (uint32_t) * uint64_t (header._nb_vertices);
+  case offsets:
+  case vertex_attr_offsets:
+    return sizeof (uint32_t) * (uint64_t (header._nb_vertices) + 1);
+  case targets:
+  case edge_order:
+    return sizeof (uint32_t) * uint64_t (header._nb_edges);
+  case edge_attr_offsets:
+    return sizeof (uint32_t) * (uint64_t (header._nb_edges) + 1);
+  case vertex_attrs:
+    return sizeof (uint32_t) * 2 * uint64_t (header._nb_vertex_attrs);
+  case edge_attrs:
+    return sizeof (uint32_t) * 2 * uint64_t (header._nb_edge_attrs);
+  default:
+    return 0;
+  }
+}
+
+// return true if all indices and offsets stored in the sections of a snapshot
+// with the given header are within their ranges. Offsets must be monotone
+// starting at zero and ending at the number of items they index, every string,
+// vertex and edge must be a valid index (edges among those of the same
+// vertex), and vertices must be sorted by name in _vertex_order, so that their
+// names are all different
+bool dot::snapshot::_verify (const header& header) const
+{
+
+  // return true if the n+1 offsets given start at zero, never decrease and
+  // end at last
+  auto monotone = [] (const auto* offsets, uint64_t n, uint64_t last) {
+    if (offsets[0] != 0 || offsets[n] != last)
+      return false;
+    for (uint64_t i = 0 ; i < n ; i++)
+      if (offsets[i] > offsets[i+1])
+	return false;
+    return true;
+  };
+
+  // return true if the n indices given are less than bound
+  auto bounded = [] (const uint32_t* indices, uint64_t n, uint32_t bound) {
+    for (uint64_t i = 0 ; i < n ; i++)
+      if (indices[i] >= bound)
+	return false;
+    return true;
+  };
+
+  if (!monotone (_string_offsets, header._nb_strings, header._nb_chars) ||
+      !monotone (_offsets, header._nb_vertices, header._nb_edges) ||
+      !monotone (_vertex_attr_offsets, header._nb_vertices, header._nb_vertex_attrs) ||
+      !monotone (_edge_attr_offsets, header._nb_edges, header._nb_edge_attrs))
+    return false;
+  if (header._type >= header._nb_strings || header._name >= header._nb_strings ||
+      !bounded (_labels, 2 * uint64_t (header._nb_labels), header._nb_strings) ||
+      !bounded (_vertex_names, header._nb_vertices, header._nb_strings) ||
+      !bounded (_vertex_order, header._nb_vertices, header._nb_vertices) ||
+      !bounded (_targets, header._nb_edges, header._nb_vertices) ||
+      !bounded (_vertex_attrs, 2 * uint64_t (header._nb_vertex_attrs), header._nb_strings) ||
+      !bounded (_edge_attrs, 2 * uint64_t (header._nb_edge_attrs), header._nb_strings))
+    return false;
+
+  // the edges of every vertex are indexed among its own edges
+  for (uint32_t id = 0 ; id < header._nb_vertices ; id++)
+    for (uint32_t edge = _offsets[id] ; edge < _offsets[id+1] ; edge++)
+      if (_edge_order[edge] < _offsets[id] || _edge_order[edge] >= _offsets[id+1])
+	return false;
+
+  // names of vertices are found with a binary search, and they are interned
+  // when restoring the graph, so that they must be strictly increasing
+  for (uint32_t i = 1 ; i < header._nb_vertices ; i++)
+    if (!(_string (_vertex_names[_vertex_order[i-1]]) < _string (_vertex_names[_vertex_order[i]])))
+      return false;
+  return true;
+}
+
+// return the location of the pair (name, value) with the given name among the n
+// pairs given in pairs, or n if it is not found
+uint32_t dot::snapshot::_find_pair (const uint32_t* pairs, uint32_t n, string_view name) const
+{
+
+  // pairs are sorted by name, so that perform a binary search
+  uint32_t first = 0, last = n;
+  while (first < last) {
+    uint32_t middle = first + (last - first) / 2;
+    if (_string (pairs[2*middle]) < name)
+      first = middle + 1;
+    else
+      last = middle;
+  }
+  return (first < n && _string (pairs[2*first]) == name) ? first : n;
+}
+
+// return a map with the n pairs (name, value) given in pairs
+std::map<std::string_view, std::string_view> dot::snapshot::_get_pairs (const uint32_t* pairs,
+									uint32_t n) const
+{
+  map<string_view, string_view> attrs;
+  for (uint32_t i = 0 ; i < n ; i++)
+    attrs.emplace_hint (attrs.end (), _string (pairs[2*i]), _string (pairs[2*i+1]));
+  return attrs;
+}
+
+// return the identifier of the vertex with the given name. In case no vertex is
+// found with the given name an exception is raised
+uint32_t dot::snapshot::_find_vertex (string_view name) const
+{
+
+  // vertices are sorted by name in _vertex_order, so that perform a binary
+  // search
+  const uint32_t* first = _vertex_order;
+  const uint32_t* last = _vertex_order + _header->_nb_vertices;
+  const uint32_t* ivertex = lower_bound (first, last, name,
+					 [this] (uint32_t id, string_view name) {
+					   return _string (_vertex_names[id]) < name;
+					 });
+  if (ivertex == last || _string (_vertex_names[*ivertex]) != name)
+    throw dot::syntax_error (" No node with the name '" + string (name) + "' has been found");
+  return *ivertex;
+}
+
+// return the location of the edge from the vertex orig to the vertex target. In
+// case the target is not a neighbour of orig an exception is raised
+uint32_t dot::snapshot::_find_edge (string_view origin, string_view target) const
+{
+
+  // verify that the specified origin actually exists
+  uint32_t orig_id = _find_vertex (origin);
+
+  // the edges of the origin are sorted by their target in _edge_order, so that
+  // perform a binary search over the identifier of the target, if it exists
+  const uint32_t* first = _edge_order + _offsets[orig_id];
+  const uint32_t* last = _edge_order + _offsets[orig_id+1];
+  const uint32_t* iedge = last;
+  try {
+    uint32_t target_id = _find_vertex (target);
+    iedge = lower_bound (first, last, target_id,
+			 [this] (uint32_t edge, uint32_t id) {
+			   return _targets[edge] < id;
+			 });
+    if (iedge != last && _targets[*iedge] != target_id)
+      iedge = last;
+  } catch (const dot::syntax_error&) {}
+  if (iedge == last)
+    throw dot::syntax_error (" The node '" + string (origin) + "' has no neighbour with the name '" + string (target) + "'");
+  return *iedge;
+}
+
+// Public services
+// ----------------------------------------------------------------------------
+
+// write a snapshot of the graph stored in the given parser into the given
+// file, along with the checksum, size and time of last modification of the
+// file it was parsed from, if known. In case it can not be written an
+// exception is raised
+void dot::snapshot::save (const parser& parser, const string& filename,
+			  uint64_t checksum, uint64_t size, int64_t mtime)
+{
+  header header {};
+  memcpy (header._magic, _magic, sizeof (_magic));
+  header._version = version;
+  header._byte_order = _byte_order;
+  header._checksum = checksum;
+  header._size = size;
+  header._mtime = mtime;
+
+  // all names and values are stored only once in the table of strings. Note
+  // that the strings are views over the contents of the parser
+  vector<string_view> strings;
+  unordered_map<string_view, uint32_t> ids;
+  auto intern = [&] (string_view name) {
+    auto result = ids.emplace (name, strings.size ());
+    if (result.second)
+      strings.push_back (name);
+    return result.first->second;
+  };
+  header._type = intern (parser._type);
+  header._name = intern (parser._name);
+
+  // labels are stored in the parser sorted by name
+  vector<uint32_t> labels;
+  for (auto& ilabel : parser._label) {
+    labels.push_back (intern (ilabel.first));
+    labels.push_back (intern (ilabel.second.get_text ()));
+  }
+
+  // vertices are given the same identifiers than in the parser, and they are
+  // indexed by name
+  vector<uint32_t> vertex_names, vertex_order (parser._ids.size ());
+  for (uint32_t id = 0 ; id < parser._ids.size () ; id++)
+    vertex_names.push_back (intern (parser._ids.get_name (id)));
+  iota (vertex_order.begin (), vertex_order.end (), 0);
+  sort (vertex_order.begin (), vertex_order.end (),
+	[&] (uint32_t a, uint32_t b) {
+	  return parser._ids.get_name (a) < parser._ids.get_name (b);
+	});
+
+  // the adjacency is stored in compressed sparse row format, along with the
+  // attributes of every vertex and edge. Attributes are stored in the parser
+  // sorted by name
+  vector<uint32_t> offsets {0}, targets, edge_order;
+  vector<uint32_t> vertex_attr_offsets {0}, vertex_attrs;
+  vector<uint32_t> edge_attr_offsets {0}, edge_attrs;
+  for (uint32_t id = 0 ; id < parser._graph.size () ; id++) {
+    for (auto& iattr : parser._vertex[id]) {
+      vertex_attrs.push_back (intern (iattr.first));
+      vertex_attrs.push_back (intern (iattr.second.get_text ()));
+    }
+    vertex_attr_offsets.push_back (vertex_attrs.size () / 2);
+
+    for (auto neighbour : parser._graph[id]) {
+      edge_order.push_back (targets.size ());
+      targets.push_back (neighbour);
+      auto iedge = parser._edge.find (parser._edge_key (id, neighbour));
+      if (iedge != parser._edge.end ())
+	for (auto& iattr : iedge->second) {
+	  edge_attrs.push_back (intern (iattr.first));
+	  edge_attrs.push_back (intern (iattr.second.get_text ()));
+	}
+      edge_attr_offsets.push_back (edge_attrs.size () / 2);
+    }
+    offsets.push_back (targets.size ());
+
+    // the edges of every vertex are indexed by their target
+    sort (edge_order.begin () + offsets[id], edge_order.end (),
+	  [&] (uint32_t a, uint32_t b) { return targets[a] < targets[b]; });
+  }
+
+  // now, lay out the table of strings
+  vector<uint64_t> string_offsets {0};
+  for (auto& name : strings)
+    string_offsets.push_back (string_offsets.back () + name.size ());
+
+  // and compute the location of every section right after the header
+  header._nb_strings = strings.size ();
+  header._nb_labels = labels.size () / 2;
+  header._nb_vertices = vertex_names.size ();
+  header._nb_edges = targets.size ();
+  header._nb_vertex_attrs = vertex_attrs.size () / 2;
+  header._nb_edge_attrs = edge_attrs.size () / 2;
+  header._nb_chars = string_offsets.back ();
+  uint64_t location = align (sizeof (header));
+  for (int s = 0 ; s < nb_sections ; s++) {
+    header._sections[s] = location;
+    location += align (_get_section_size (header, section (s)));
+  }
+
+  // finally, write all sections in the same order they are laid out
+  ofstream stream (filename, ios::binary);
+  if (!stream)
+    throw invalid_argument ("it was not possible to write the snapshot '" + filename + "'");
+  write_section (stream, &header, sizeof (header));
+  write_section (stream, string_offsets.data (), sizeof (uint64_t) * string_offsets.size ());
+  for (auto& name : strings)
+    stream.write (name.data (), name.size ());
+  write_section (stream, nullptr, _get_section_size (header, string_bytes));
+  const vector<uint32_t>* sections[] = {&labels, &vertex_names, &vertex_order,
+					&offsets, &targets, &edge_order,
+					&vertex_attr_offsets, &vertex_attrs,
+					&edge_attr_offsets, &edge_attrs};
+  for (auto isection : sections)
+    write_section (stream, isection->data (), sizeof (uint32_t) * isection->size ());
+  if (!stream.flush ())
+    throw invalid_argument ("it was not possible to write the snapshot '" + filename + "'");
+}
+
+// load the snapshot stored in the file given in the explicit constructor, which
+// is mapped into memory if possible. It returns true if the snapshot could be
+// successfully loaded. Otherwise, it raises an exception with an error message
+bool dot::snapshot::load ()
+{
+  _header = nullptr;
+  if (!_input.open (_filename))
+    throw invalid_argument ("file not found '" + _filename + "'");
+
+  // verify the header of the snapshot
+  string_view contents = _input.get_contents ();
+  const header* header = reinterpret_cast<const struct header*> (contents.data ());
+  if (contents.size () < sizeof (*header) ||
+      memcmp (header->_magic, _magic, sizeof (_magic)))
+    throw invalid_argument ("the file '" + _filename + "' is not a snapshot");
+  if (header->_byte_order != _byte_order)
+    throw invalid_argument ("the snapshot '" + _filename + "' was written with a different byte order");
+  if (header->_version != version)
+    throw invalid_argument ("the version " + to_string (header->_version) + " of the snapshot '" + _filename + "' is not supported");
+  for (int s = 0 ; s < nb_sections ; s++) {
+    if (header->_sections[s] % 8 ||
+	header->_sections[s] > contents.size () ||
+	_get_section_size (*header, section (s)) > contents.size () - header->_sections[s])
+      throw invalid_argument ("the snapshot '" + _filename + "' is truncated");
+  }
+
+  // and make all sections point to the contents of the file
+  auto locate = [&] (section s) {
+    return reinterpret_cast<const uint32_t*> (contents.data () + header->_sections[s]);
+  };
+  _string_offsets = reinterpret_cast<const uint64_t*> (contents.data () + header->_sections[string_offsets]);
+  _string_bytes = contents.data () + header->_sections[string_bytes];
+  _labels = locate (labels);
+  _vertex_names = locate (vertex_names);
+  _vertex_order = locate (vertex_order);
+  _offsets = locate (offsets);
+  _targets = locate (targets);
+  _edge_order = locate (edge_order);
+  _vertex_attr_offsets = locate (vertex_attr_offsets);
+  _vertex_attrs = locate (vertex_attrs);
+  _edge_attr_offsets = locate (edge_attr_offsets);
+  _edge_attrs = locate (edge_attrs);
+
+  // finally, verify that every index in the sections is within its range, so
+  // that corrupted snapshots are never used
+  if (!_verify (*header))
+    throw invalid_argument ("the snapshot '" + _filename + "' is corrupted");
+  _header = header;
+
+  return true;
+}
+
+// copy the whole graph of this snapshot into the given parser, which should be
+// empty. Nothing is parsed and vertices are given the same identifiers they
+// have in this snapshot
+void dot::snapshot::restore (parser& parser) const
+{
+  parser._type = get_type ();
+  parser._name = get_name ();
+
+  // labels and attributes are already sorted by name, so that they are
+  // appended at the end of their maps
+  for (uint32_t i = 0 ; i < _header->_nb_labels ; i++)
+    parser._label.emplace_hint (parser._label.end (),
+				_string (_labels[2*i]), _string (_labels[2*i+1]));
+
+  // add all vertices in the same order of their identifiers, along with their
+  // attributes
+  parser._graph.resize (_header->_nb_vertices);
+  parser._vertex.resize (_header->_nb_vertices);
+  for (uint32_t id = 0 ; id < _header->_nb_vertices ; id++) {
+    parser._ids.intern (_string (_vertex_names[id]));
+    for (uint32_t i = _vertex_attr_offsets[id] ; i < _vertex_attr_offsets[id+1] ; i++)
+      parser._vertex[id].emplace_hint (parser._vertex[id].end (),
+				       _string (_vertex_attrs[2*i]),
+				       _string (_vertex_attrs[2*i+1]));
+  }
+
+  // and finally all edges with their attributes
+  parser._edges.reserve (_header->_nb_edges);
+  for (uint32_t id = 0 ; id < _header->_nb_vertices ; id++) {
+    parser._graph[id].assign (_targets + _offsets[id], _targets + _offsets[id+1]);
+    for (uint32_t edge = _offsets[id] ; edge < _offsets[id+1] ; edge++) {
+      uint64_t key = parser._edge_key (id, _targets[edge]);
+      parser._edges.insert (key);
+      if (_edge_attr_offsets[edge] == _edge_attr_offsets[edge+1])
+	continue;
+      auto& attrs = parser._edge[key];
+      for (uint32_t i = _edge_attr_offsets[edge] ; i < _edge_attr_offsets[edge+1] ; i++)
+	attrs.emplace_hint (attrs.end (), _string (_edge_attrs[2*i]),
+			    _string (_edge_attrs[2*i+1]));
+    }
+  }
+}
+
+// get all labels of this graph
+std::vector<std::string_view> dot::snapshot::get_labels () const
+{
+  vector<string_view> labels;
+  for (uint32_t i = 0 ; i < _header->_nb_labels ; i++)
+    labels.push_back (_string (_labels[2*i]));
+  return labels;
+}
+
+// get the value of the label with the specified name
+std::string_view dot::snapshot::get_label_value (string_view name) const
+{
+
+  // verify that the specified label actually exists
+  uint32_t ilabel = _find_pair (_labels, _header->_nb_labels, name);
+  if (ilabel == _header->_nb_labels)
+    throw dot::syntax_error (" No label with the name '" + string (name) + "' has been found");
+
+  // otherwise return the value of this label
+  return _string (_labels[2*ilabel+1]);
+}
+
+// get all source vertices of the graph, sorted by name
+std::vector<std::string_view> dot::snapshot::get_vertices () const
+{
+  vector<string_view> vertices;
+  for (uint32_t i = 0 ; i < _header->_nb_vertices ; i++)
+    vertices.push_back (_string (_vertex_names[_vertex_order[i]]));
+  return vertices;
+}
+
+// return the graph parsed as a map where the index is a source vertex and the
+// value is a vector of target vertices.
+std::map<std::string_view, std::vector<std::string_view>> dot::snapshot::get_graph () const
+{
+
+  // as in the parser, only vertices with neighbours are returned
+  map<string_view, vector<string_view>> graph;
+  for (uint32_t id = 0 ; id < _header->_nb_vertices ; id++)
+    if (_offsets[id] < _offsets[id+1]) {
+      vector<string_view>& neighbours = graph[_string (_vertex_names[id])];
+      for (uint32_t edge = _offsets[id] ; edge < _offsets[id+1] ; edge++)
+	neighbours.push_back (_string (_vertex_names[_targets[edge]]));
+    }
+  return graph;
+}
+
+// get all nodes that are reachable from a given node. In case no node is found
+// with the given node an exception is raised.
+std::vector<std::string_view> dot::snapshot::get_neighbours (string_view name) const
+{
+  uint32_t id = _find_vertex (name);
+  vector<string_view> neighbours;
+  for (uint32_t edge = _offsets[id] ; edge < _offsets[id+1] ; edge++)
+    neighbours.push_back (_string (_vertex_names[_targets[edge]]));
+  return neighbours;
+}
+
+// get the name of the vertex with the given identifier. In case no vertex is
+// found with the given identifier an exception is raised.
+std::string_view dot::snapshot::get_vertex_name (uint32_t id) const
+{
+  if (id >= _header->_nb_vertices)
+    throw out_of_range ("no name has the identifier " + to_string (id));
+  return _string (_vertex_names[id]);
+}
+
+// get the identifiers of all nodes that are reachable from the node with the
+// given identifier. In case no vertex is found with the given identifier an
+// exception is raised.
+std::vector<uint32_t> dot::snapshot::get_neighbour_ids (uint32_t id) const
+{
+  range<const uint32_t*> neighbours = get_neighbour_range (id);
+  return vector<uint32_t> (neighbours.begin (), neighbours.end ());
+}
+
+// return the graph in compressed sparse row format
+dot::csr dot::snapshot::get_csr () const
+{
+  csr graph;
+  graph._offsets.assign (_offsets, _offsets + _header->_nb_vertices + 1);
+  graph._targets.assign (_targets, _targets + _header->_nb_edges);
+  graph._attribute_ids.reserve (_header->_nb_edges);
+  for (uint32_t edge = 0 ; edge < _header->_nb_edges ; edge++) {
+    uint32_t first = _edge_attr_offsets[edge], last = _edge_attr_offsets[edge+1];
+    if (first == last)
+      graph._attribute_ids.push_back (csr::npos);
+    else {
+      graph._attribute_ids.push_back (graph._attributes.size ());
+      graph._attributes.emplace_back ();
+      for (uint32_t i = first ; i < last ; i++)
+	graph._attributes.back ().emplace (_string (_edge_attrs[2*i]),
+					   _string (_edge_attrs[2*i+1]));
+    }
+  }
+  return graph;
+}
+
+// get all attributes of all vertices of the graph
+std::map<std::string_view, std::map<std::string_view, std::string_view>> dot::snapshot::get_all_vertex_attributes () const
+{
+  map<string_view, map<string_view, string_view>> attrs;
+  for (uint32_t id = 0 ; id < _header->_nb_vertices ; id++)
+    if (_vertex_attr_offsets[id] < _vertex_attr_offsets[id+1])
+      attrs[_string (_vertex_names[id])] =
+	_get_pairs (_vertex_attrs + 2*_vertex_attr_offsets[id],
+		    _vertex_attr_offsets[id+1] - _vertex_attr_offsets[id]);
+  return attrs;
+}
+
+// get all the attributes of the specified vertex. In case no node is found with
+// the given node an exception is raised.
+std::map<std::string_view, std::string_view> dot::snapshot::get_vertex_attributes (string_view name) const
+{
+  uint32_t id = _find_vertex (name);
+  return _get_pairs (_vertex_attrs + 2*_vertex_attr_offsets[id],
+		     _vertex_attr_offsets[id+1] - _vertex_attr_offsets[id]);
+}
+
+// return the value of an attribute defined for a specific vertex. In case no
+// node is found with the given node, or no attribute with the given name is
+// found for the specified node, an exception is raised.
+std::string_view dot::snapshot::get_vertex_attribute (string_view name, string_view attrname) const
+{
+  uint32_t id = _find_vertex (name);
+  const uint32_t* attrs = _vertex_attrs + 2*_vertex_attr_offsets[id];
+  uint32_t nb_attrs = _vertex_attr_offsets[id+1] - _vertex_attr_offsets[id];
+  uint32_t iattr = _find_pair (attrs, nb_attrs, attrname);
+  if (iattr == nb_attrs)
+    throw dot::syntax_error (" The node '" + string (name) + "' has no attribute with the name '" + string (attrname) + "'");
+  return _string (attrs[2*iattr+1]);
+}
+
+// get the edge attributes for all edges in the graph that have any
+std::map<std::string_view, std::map<std::string_view, std::map<std::string_view, std::string_view>>> dot::snapshot::get_all_edge_attributes () const
+{
+  map<string_view, map<string_view, map<string_view, string_view>>> attrs;
+  for (uint32_t id = 0 ; id < _header->_nb_vertices ; id++)
+    for (uint32_t edge = _offsets[id] ; edge < _offsets[id+1] ; edge++)
+      if (_edge_attr_offsets[edge] < _edge_attr_offsets[edge+1])
+	attrs[_string (_vertex_names[id])][_string (_vertex_names[_targets[edge]])] =
+	  _get_pairs (_edge_attrs + 2*_edge_attr_offsets[edge],
+		      _edge_attr_offsets[edge+1] - _edge_attr_offsets[edge]);
+  return attrs;
+}
+
+// get all the attributes of a specific edge qualified by its (origin,target)
+// names. If either the origin does not exist, or the target is not found to be
+// a neighbour of the origin, an exception is raised.
+std::map<std::string_view, std::string_view> dot::snapshot::get_edge_attributes (string_view origin,
+										 string_view target) const
+{
+  uint32_t edge = _find_edge (origin, target);
+  return _get_pairs (_edge_attrs + 2*_edge_attr_offsets[edge],
+		     _edge_attr_offsets[edge+1] - _edge_attr_offsets[edge]);
+}
+
+// return the value of the given attribute defined for the vertex qualified by
+// (origin,target) names. If either the origin does not exist, or the target is
+// not found to be a neighbour of the origin, or the edge has attributes but
+// none with the given name, an exception is raised. As in the parser, edges
+// with no attributes at all have an empty value for every attribute
+std::string_view dot::snapshot::get_edge_attribute (string_view origin,
+						    string_view target,
+						    string_view attrname) const
+{
+  uint32_t edge = _find_edge (origin, target);
+  const uint32_t* attrs = _edge_attrs + 2*_edge_attr_offsets[edge];
+  uint32_t nb_attrs = _edge_attr_offsets[edge+1] - _edge_attr_offsets[edge];
+  if (!nb_attrs)
+    return string_view ();
+  uint32_t iattr = _find_pair (attrs, nb_attrs, attrname);
+  if (iattr == nb_attrs)
+    throw dot::syntax_error (" The edge joining vertices '" + string (origin) + "' and '" + string (target) + "' has no attribute named '" + string (attrname) + "'");
+  return _string (attrs[2*iattr+1]);
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
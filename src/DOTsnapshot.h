@@ -0,0 +1,300 @@
+/*
+  DOTsnapshot.h
+  Description: Binary snapshots of parsed graphs
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 12:41:09 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	SNAPSHOT_H_
+# define   	SNAPSHOT_H_
+
+// A snapshot is a binary file with everything a parser holds: the type and
+// name of the graph, its labels, the adjacency of all vertices and the
+// attributes of vertices and edges. Snapshots are written once a graph has
+// been parsed, and they are later mapped into memory and used directly,
+// without parsing nor copying anything, with the same services provided by
+// the parser.
+//
+// All names and values are stored only once in a table of strings, and they
+// are referred to by their index in it. The adjacency is stored in compressed
+// sparse row format, and labels and attributes are sorted by name so that
+// they are found with a binary search. All sections are aligned to 8 bytes,
+// and numbers are stored in the byte order of the machine which wrote the
+// snapshot, which is verified when loading it.
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DOTcsr.h"
+#include "DOTinput.h"
+#include "DOTparser.h"
+#include "DOTrange.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a snapshot of a parsed graph
+  class snapshot {
+
+  public:
+
+    // version of the format of snapshots written by this library. Snapshots
+    // with a different version can not be loaded
+    static constexpr uint32_t version = 2;
+
+  private:
+
+    // every snapshot starts with a header which stores the number of items of
+    // every kind and the offset of every section of the file
+    enum section { string_offsets, string_bytes, labels, vertex_names,
+		   vertex_order, offsets, targets, edge_order,
+		   vertex_attr_offsets, vertex_attrs, edge_attr_offsets,
+		   edge_attrs, nb_sections };
+    struct header {
+      char _magic[8];                  // identification of snapshot files
+      uint32_t _version;                           // version of the format
+      uint32_t _byte_order;               // byte order of the machine
+      uint32_t _type;                        // index of the type of the graph
+      uint32_t _name;                        // index of the name of the graph
+      uint32_t _nb_strings;                    // number of different strings
+      uint32_t _nb_labels;                                 // number of labels
+      uint32_t _nb_vertices;                             // number of vertices
+      uint32_t _nb_edges;                                   // number of edges
+      uint32_t _nb_vertex_attrs;            // number of vertex attributes
+      uint32_t _nb_edge_attrs;                // number of edge attributes
+      uint64_t _nb_chars;           // number of characters of all strings
+      uint64_t _checksum;      // checksum of the contents, zero if unknown
+      uint64_t _size;              // size of the file parsed, zero if unknown
+      int64_t _mtime;     // time of last modification of the file, if known
+      uint64_t _sections[nb_sections];        // offset of every section
+    };
+
+    // INVARIANTS: every snapshot owns the file it was loaded from, which is
+    // mapped into memory if possible. The header and all sections are just
+    // pointers to it
+    string _filename;                          // filename with the snapshot
+    input _input;                                   // contents of the file
+    const header* _header;                       // header of the snapshot
+
+    // the table of strings consists of the offsets where every string starts
+    // (with an additional one for the end of the last one) and all their
+    // characters
+    const uint64_t* _string_offsets;
+    const char* _string_bytes;
+
+    // labels are stored as pairs (name, value), sorted by name
+    const uint32_t* _labels;
+
+    // every vertex is identified with the same identifier given by the parser,
+    // so that _vertex_names stores the name of every vertex, and _vertex_order
+    // stores the identifiers of all vertices sorted by name
+    const uint32_t* _vertex_names;
+    const uint32_t* _vertex_order;
+
+    // the adjacency is stored in compressed sparse row format, i.e., the
+    // neighbours of the vertex v are _targets[_offsets[v]] ...
+    // _targets[_offsets[v+1]-1]. _edge_order stores, for every vertex, the
+    // location of its edges sorted by the target vertex
+    const uint32_t* _offsets;
+    const uint32_t* _targets;
+    const uint32_t* _edge_order;
+
+    // the attributes of every vertex and edge are stored as pairs (name,
+    // value) sorted by name, and the location where those of every vertex and
+    // edge start is given in the same way than the neighbours of every vertex
+    const uint32_t* _vertex_attr_offsets;
+    const uint32_t* _vertex_attrs;
+    const uint32_t* _edge_attr_offsets;
+    const uint32_t* _edge_attrs;
+
+    // magic number and byte order written in the header of every snapshot
+    static constexpr char _magic[8] = {'D', 'O', 'T', 'S', 'N', 'A', 'P', '\0'};
+    static constexpr uint32_t _byte_order = 0x01020304;
+
+  private:
+
+    // return the size in bytes of the given section of a snapshot with the
+    // given header
+    static uint64_t _get_section_size (const header& header, section s);
+
+    // return true if all indices and offsets stored in the sections of a
+    // snapshot with the given header are within their ranges
+    bool _verify (const header& header) const;
+
+    // return the string with the given index
+    string_view _string (uint32_t index) const
+    {
+      return string_view (_string_bytes + _string_offsets[index],
+			  _string_offsets[index+1] - _string_offsets[index]);
+    }
+
+    // return the location of the pair (name, value) with the given name among
+    // the n pairs given in pairs, or n if it is not found
+    uint32_t _find_pair (const uint32_t* pairs, uint32_t n, string_view name) const;
+
+    // return a map with the n pairs (name, value) given in pairs
+    map<string_view, string_view> _get_pairs (const uint32_t* pairs, uint32_t n) const;
+
+    // return the identifier of the vertex with the given name. In case no
+    // vertex is found with the given name an exception is raised
+    uint32_t _find_vertex (string_view name) const;
+
+    // return the location of the edge from the vertex orig to the vertex
+    // target. In case the target is not a neighbour of orig an exception is
+    // raised
+    uint32_t _find_edge (string_view origin, string_view target) const;
+
+  public:
+
+    // Default constructor
+    snapshot ()
+      : snapshot {""}
+    {}
+
+    // Explicit constructor
+    explicit snapshot (const string& filename)
+      : _filename {filename},
+	_header {nullptr}
+    {}
+
+    // snapshots can be neither copied nor moved, as all their contents are
+    // pointers to the file they own
+    snapshot (const snapshot&) = delete;
+    snapshot& operator= (const snapshot&) = delete;
+
+    // write a snapshot of the graph stored in the given parser into the given
+    // file, along with the checksum, size and time of last modification of
+    // the file it was parsed from, if known. In case it can not be written an
+    // exception is raised
+    static void save (const parser& parser, const string& filename,
+		      uint64_t checksum = 0, uint64_t size = 0, int64_t mtime = 0);
+
+    // load the snapshot stored in the file given in the explicit constructor,
+    // which is mapped into memory if possible. It returns true if the
+    // snapshot could be successfully loaded. Otherwise, it raises an exception
+    // with an error message, also if any index or offset stored in the
+    // sections is out of its range, so that corrupted snapshots are never
+    // used. Verifying them takes time linear in the size of the snapshot, but
+    // nothing is copied. None of the services below can be used before
+    // loading a snapshot
+    bool load ();
+
+    // copy the whole graph of this snapshot into the given parser, which
+    // should be empty. Nothing is parsed and vertices are given the same
+    // identifiers they have in this snapshot
+    void restore (parser& parser) const;
+
+    // get/set accessors
+    uint64_t get_checksum () const
+    { return _header->_checksum; }
+    uint64_t get_size () const
+    { return _header->_size; }
+    int64_t get_mtime () const
+    { return _header->_mtime; }
+    string_view get_type () const
+    { return _string (_header->_type); }
+    string_view get_name () const
+    { return _string (_header->_name); }
+
+    // get all labels of this graph
+    vector<string_view> get_labels () const;
+
+    // get the value of the label with the specified name
+    string_view get_label_value (string_view name) const;
+
+    // get all source vertices of the graph, sorted by name
+    vector<string_view> get_vertices () const;
+
+    // return the graph parsed as a map where the index is a source vertex and
+    // the value is a vector of target vertices.
+    map<string_view, vector<string_view>> get_graph () const;
+
+    // get all nodes that are reachable from a given node. In case no node is
+    // found with the given node an exception is raised.
+    vector<string_view> get_neighbours (string_view name) const;
+
+    // get the number of vertices of the graph
+    size_t get_nb_vertices () const
+    { return _header->_nb_vertices; }
+
+    // get the identifier of the vertex with the given name, which is the same
+    // given by the parser. In case no vertex is found with the given name an
+    // exception is raised.
+    uint32_t get_vertex_id (string_view name) const
+    { return _find_vertex (name); }
+
+    // get the name of the vertex with the given identifier. In case no vertex
+    // is found with the given identifier an exception is raised.
+    string_view get_vertex_name (uint32_t id) const;
+
+    // get the identifiers of all nodes that are reachable from the node with
+    // the given identifier. In case no vertex is found with the given
+    // identifier an exception is raised.
+    vector<uint32_t> get_neighbour_ids (uint32_t id) const;
+
+    // get the identifiers of all nodes that are reachable from the node with
+    // the given identifier or name as a range over the snapshot, i.e., in
+    // constant time and without copying them. In case no vertex is found an
+    // exception is raised.
+    range<const uint32_t*> get_neighbour_range (uint32_t id) const
+    {
+      if (id >= _header->_nb_vertices)
+	throw out_of_range ("no vertex has the identifier " + to_string (id));
+      return {_targets + _offsets[id], _targets + _offsets[id+1]};
+    }
+    range<const uint32_t*> get_neighbour_range (string_view name) const
+    { return get_neighbour_range (_find_vertex (name)); }
+
+    // return the graph in compressed sparse row format
+    csr get_csr () const;
+
+    // get all attributes of all vertices of the graph
+    map<string_view, map<string_view, string_view>> get_all_vertex_attributes () const;
+
+    // get all the attributes of the specified vertex. In case no node is found
+    // with the given node an exception is raised.
+    map<string_view, string_view> get_vertex_attributes (string_view name) const;
+
+    // return the value of an attribute defined for a specific vertex. In case
+    // no node is found with the given node, or no attribute with the given name
+    // is found for the specified node, an exception is raised.
+    string_view get_vertex_attribute (string_view name, string_view attrname) const;
+
+    // get the edge attributes for all edges in the graph that have any
+    map<string_view, map<string_view, map<string_view, string_view>>> get_all_edge_attributes () const;
+
+    // get all the attributes of a specific edge qualified by its
+    // (origin,target) names. If either the origin does not exist, or the target
+    // is not found to be a neighbour of the origin, an exception is raised.
+    map<string_view, string_view> get_edge_attributes (string_view origin, string_view target) const;
+
+    // return the value of the given attribute defined for the vertex qualified
+    // by (origin,target) names. If either the origin does not exist, or the
+    // target is not found to be a neighbour of the origin, or the edge has
+    // attributes but none with the given name, an exception is raised. As in
+    // the parser, edges with no attributes at all have an empty value for
+    // every attribute
+    string_view get_edge_attribute (string_view origin, string_view target, string_view attrname) const;
+
+  };  // class snapshot
+
+} // namespace dot
+
+#endif 	    /* !SNAPSHOT_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,286 @@
+/*
+  DOTstats.h
+  Description: Statistics of the parsing process
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 19:41:52 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	STATS_H_
+# define   	STATS_H_
+
+// Parsers can collect statistics of the parsing process: the wall time spent
+// in every phase, the number of tokens of every kind, the bytes read, the
+// memory allocated and the peak sizes of their containers. Statistics are
+// collected only if the macro DOT_STATS is defined when compiling the library
+// (e.g., ./configure CPPFLAGS=-DDOT_STATS). Otherwise, all the probes are
+// compiled out and all statistics are zero, so that they cost nothing. Note
+// that programs using the library have to be compiled with the same
+// definition.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "DOTlexer.h"
+
+// the following macros are the probes used to collect statistics. The first
+// one measures the wall time elapsed until the end of the current scope in
+// the given phase of the given statistics, and the second one executes the
+// given statement. Both are compiled out unless DOT_STATS is defined
+#ifdef DOT_STATS
+# define DOT_STATS_PHASE(stats, phase) dot::phase_timer dot_stats_timer {(stats), (phase)}
+# define DOT_STATS_RUN(statement) statement
+#else
+# define DOT_STATS_PHASE(stats, phase)
+# define DOT_STATS_RUN(statement)
+#endif
+
+namespace dot {
+
+  using namespace std;
+
+  // Enum definition
+  //
+  // phases of the parsing process whose wall time is measured. Phases are
+  // nested, e.g., the time spent in blocks of multiple vertices includes the
+  // time spent in the comments, attributes and graph updates found in them
+  enum class phase : unsigned char {
+    comments,                                      // skipping comments
+    attributes,                                   // reading attribute sections
+    multiple_vertices,                 // reading blocks of multiple targets
+    graph_updates                                    // adding edges to the graph
+  };
+
+  // number of different phases
+  constexpr size_t nbphases = 4;
+
+  // Struct definition
+  //
+  // Definition of the statistics of the parsing process
+  struct stats {
+
+    // whether statistics are collected or not
+#ifdef DOT_STATS
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    array<double, nbphases> seconds;           // wall time of every phase
+    array<uint64_t, nbtokens> tokens;           // tokens read of every kind
+    uint64_t bytes;                                           // bytes read
+    uint64_t allocations;                      // number of allocations made
+    uint64_t allocated_bytes;                             // bytes allocated
+    uint64_t peak_memory;                // peak number of bytes allocated
+    size_t peak_pending;            // peak number of bytes fed but not read
+    size_t peak_attributes;         // peak number of attributes in a section
+    size_t peak_degree;               // peak number of neighbours of a vertex
+    size_t nb_statements;                               // number of statements
+    size_t nb_vertices;                                   // number of vertices
+    size_t nb_edges;                                         // number of edges
+    size_t nb_labels;                                       // number of labels
+
+    // Default constructor, which creates empty statistics
+    stats ()
+      : seconds {},
+	tokens {},
+	bytes {0},
+	allocations {0},
+	allocated_bytes {0},
+	peak_memory {0},
+	peak_pending {0},
+	peak_attributes {0},
+	peak_degree {0},
+	nb_statements {0},
+	nb_vertices {0},
+	nb_edges {0},
+	nb_labels {0}
+    {}
+
+    // get the wall time spent in the given phase, in seconds
+    double get_seconds (phase p) const
+    { return seconds[size_t (p)]; }
+
+    // get the number of tokens of the given kind read
+    uint64_t get_tokens (token t) const
+    { return tokens[size_t (t)]; }
+
+    // add the statistics of the given parsing process to these ones. Counters
+    // are added while peaks are maximized
+    stats& operator+= (const stats& other)
+    {
+      for (size_t i = 0 ; i < nbphases ; i++)
+	seconds[i] += other.seconds[i];
+      for (size_t i = 0 ; i < nbtokens ; i++)
+	tokens[i] += other.tokens[i];
+      bytes += other.bytes;
+      allocations += other.allocations;
+      allocated_bytes += other.allocated_bytes;
+      peak_memory = max (peak_memory, other.peak_memory);
+      peak_pending = max (peak_pending, other.peak_pending);
+      peak_attributes = max (peak_attributes, other.peak_attributes);
+      peak_degree = max (peak_degree, other.peak_degree);
+      nb_statements += other.nb_statements;
+      nb_vertices += other.nb_vertices;
+      nb_edges += other.nb_edges;
+      nb_labels += other.nb_labels;
+      return *this;
+    }
+
+    // return the name of the given phase
+    static string_view get_name (phase p)
+    {
+      static constexpr string_view names[nbphases] = {
+	"comments", "attributes", "multiple vertices", "graph updates"
+      };
+      return names[size_t (p)];
+    }
+
+    // return the name of the given kind of token, as defined in DOTdefs.h
+    static string_view get_name (token t)
+    {
+      static constexpr string_view names[nbtokens] = {
+	"GRAPH_TYPE", "GRAPH_NAME", "BLOCK_BEGIN", "BLOCK_END",
+	"LABEL_ASSIGNMENT", "LABEL_VALUE", "VERTEX_NAME", "EDGE_TYPE",
+	"END_OF_STATEMENT", "CPP_COMMENT", "ATTRIBUTE_BEGIN", "ATTRIBUTE_NAME",
+	"ATTRIBUTE_VALUE_NEXT", "ATTRIBUTE_VALUE_END", "ATTRIBUTE_END"
+      };
+      return names[size_t (t)];
+    }
+
+  }; // struct stats
+
+  // show the given statistics on the given stream, one per line. Only those
+  // kinds of tokens which were read are shown
+  inline ostream& operator<< (ostream& stream, const stats& stats)
+  {
+    auto line = [&stream] (const string& name, auto value) {
+      stream << " " << name << string (name.size () < 24 ? 24 - name.size () : 0, ' ')
+	     << ": " << value << '\n';
+    };
+    line ("bytes", stats.bytes);
+    for (size_t i = 0 ; i < nbphases ; i++)
+      line (string (stats::get_name (phase (i))) + " (seconds)", stats.seconds[i]);
+    for (size_t i = 0 ; i < nbtokens ; i++)
+      if (stats.tokens[i])
+	line (string (stats::get_name (token (i))), stats.tokens[i]);
+    line ("allocations", stats.allocations);
+    line ("allocated bytes", stats.allocated_bytes);
+    line ("peak memory", stats.peak_memory);
+    line ("peak pending", stats.peak_pending);
+    line ("peak attributes", stats.peak_attributes);
+    line ("peak degree", stats.peak_degree);
+    line ("statements", stats.nb_statements);
+    line ("vertices", stats.nb_vertices);
+    line ("edges", stats.nb_edges);
+    line ("labels", stats.nb_labels);
+    return stream;
+  }
+
+  // Class definition
+  //
+  // Definition of a timer which adds the wall time elapsed since its creation
+  // to a phase of the given statistics when it is destroyed
+  class phase_timer {
+
+  private:
+
+    double& _seconds;                        // wall time of the phase measured
+    chrono::steady_clock::time_point _start;      // when measuring started
+
+  public:
+
+    // Explicit constructor
+    phase_timer (stats& stats, phase p)
+      : _seconds {stats.seconds[size_t (p)]},
+	_start {chrono::steady_clock::now ()}
+    {}
+
+    // timers can be neither copied nor moved
+    phase_timer (const phase_timer&) = delete;
+    phase_timer& operator= (const phase_timer&) = delete;
+
+    // Destructor
+    ~phase_timer ()
+    { _seconds += chrono::duration<double> (chrono::steady_clock::now () - _start).count (); }
+
+  }; // class phase_timer
+
+  // Class definition
+  //
+  // Definition of a memory resource which counts the allocations made and
+  // takes the memory from another resource
+  class counting_resource : public pmr::memory_resource {
+
+  private:
+
+    // INVARIANTS: all memory is taken from _upstream. _current is the number
+    // of bytes allocated but not deallocated yet
+    pmr::memory_resource* _upstream;              // resource memory is taken from
+    uint64_t _allocations;                      // number of allocations made
+    uint64_t _bytes;                                      // bytes allocated
+    uint64_t _current;                            // bytes currently allocated
+    uint64_t _peak;                          // peak of bytes allocated at once
+
+    void* do_allocate (size_t bytes, size_t alignment) override
+    {
+      void* ptr = _upstream->allocate (bytes, alignment);
+      _allocations++;
+      _bytes += bytes;
+      _current += bytes;
+      _peak = max (_peak, _current);
+      return ptr;
+    }
+
+    void do_deallocate (void* ptr, size_t bytes, size_t alignment) override
+    {
+      _upstream->deallocate (ptr, bytes, alignment);
+      _current -= bytes;
+    }
+
+    bool do_is_equal (const pmr::memory_resource& other) const noexcept override
+    { return this == &other; }
+
+  public:
+
+    // Explicit constructor
+    explicit counting_resource (pmr::memory_resource* upstream)
+      : _upstream {upstream},
+	_allocations {0},
+	_bytes {0},
+	_current {0},
+	_peak {0}
+    {}
+
+    // get accessors
+    pmr::memory_resource* get_upstream () const
+    { return _upstream; }
+    uint64_t get_allocations () const
+    { return _allocations; }
+    uint64_t get_bytes () const
+    { return _bytes; }
+    uint64_t get_peak () const
+    { return _peak; }
+
+  }; // class counting_resource
+
+} // namespace dot
+
+#endif 	    /* !STATS_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
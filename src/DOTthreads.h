@@ -0,0 +1,76 @@
+/*
+  DOTthreads.h
+  Description: Groups of threads which are always joined
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 23:41:08 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	THREADS_H_
+# define   	THREADS_H_
+
+// A group of threads joins all the threads it started when it is destroyed, so
+// that if an exception is raised after starting some of them (e.g., when
+// another thread can not be started), the threads already running are joined
+// while unwinding instead of invoking std::terminate
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a group of threads
+  class thread_group {
+
+  private:
+
+    // INVARIANTS: all threads in the group are joined, at the latest, when
+    // the group is destroyed
+    vector<thread> _threads;
+
+  public:
+
+    // Default constructor
+    thread_group () = default;
+
+    // Groups of threads can not be copied
+    thread_group (const thread_group&) = delete;
+    thread_group& operator= (const thread_group&) = delete;
+
+    // Destructor
+    ~thread_group ()
+    { join (); }
+
+    // start a new thread which executes the given function with the given
+    // arguments
+    template<class Function, class... Args>
+    void spawn (Function&& function, Args&&... args)
+    { _threads.emplace_back (forward<Function> (function), forward<Args> (args)...); }
+
+    // wait for all threads in the group to finish
+    void join ()
+    {
+      for (auto& thread : _threads)
+	if (thread.joinable ())
+	  thread.join ();
+    }
+  };
+
+} // namespace dot
+
+#endif 	    /* !THREADS_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
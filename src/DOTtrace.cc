@@ -0,0 +1,97 @@
+/*
+  DOTtrace.cc
+  Description: Structured trace of the tokens read
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 20:31:08 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <charconv>
+#include <stdexcept>
+
+#include "DOTtrace.h"
+
+namespace dot {
+
+  // Explicit constructor
+  ring_sink::ring_sink (size_t capacity)
+    : _capacity {capacity},
+      _first {0}
+  {
+    if (!capacity)
+      throw invalid_argument ("the capacity of a ring of events must be positive");
+    _events.reserve (capacity);
+    _values.reserve (capacity);
+  }
+
+  // remove all events
+  void ring_sink::clear ()
+  {
+    _events.clear ();
+    _values.clear ();
+    _first = 0;
+  }
+
+  // take the given events, overwriting the oldest ones if necessary. Values are
+  // copied, as they are not valid once the events are taken
+  void ring_sink::write (const trace_event* events, size_t nbevents)
+  {
+    for (size_t i = 0 ; i < nbevents ; i++) {
+
+      // while the ring is not full, events are just added at its end
+      size_t location;
+      if (_events.size () < _capacity) {
+	location = _events.size ();
+	_events.push_back (events[i]);
+	_values.emplace_back (events[i].value);
+      } else {
+	location = _first;
+	_first = (_first + 1) % _capacity;
+	_events[location] = events[i];
+	_values[location].assign (events[i].value);
+      }
+      _events[location].value = _values[location];
+    }
+  }
+
+  // write the given events into the stream, one per line preceded by its
+  // offset. All of them are written at once
+  void stream_sink::write (const trace_event* events, size_t nbevents)
+  {
+    _buffer.clear ();
+    for (size_t i = 0 ; i < nbevents ; i++) {
+      char digits[20];
+      auto result = to_chars (digits, digits + sizeof digits, events[i].offset);
+      _buffer.append (digits, result.ptr - digits);
+      _buffer += " [";
+      _buffer += events[i].label;
+      if (!events[i].value.empty ()) {
+	_buffer += ' ';
+	_buffer += events[i].value;
+      }
+      _buffer += "]\n";
+    }
+    _stream.write (_buffer.data (), _buffer.size ());
+  }
+
+  // Explicit constructor. In case the file can not be created an exception is
+  // raised
+  file_sink::file_sink (const string& filename)
+    : _file {filename, ios::binary},
+      _sink {_file}
+  {
+    if (!_file)
+      throw invalid_argument ("the file '" + filename + "' could not be created");
+  }
+
+} // namespace dot
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
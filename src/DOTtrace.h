@@ -0,0 +1,293 @@
+/*
+  DOTtrace.h
+  Description: Structured trace of the tokens read
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 20:31:08 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	TRACE_H_
+# define   	TRACE_H_
+
+// Readers can trace the tokens they read as events which are given to a
+// sink. Events are buffered and given to the sink in batches, either when the
+// buffer is full or when the reader is done with the contents, so that the
+// views they contain are still valid. Sinks can keep the last events in a ring
+// buffer, write them into a stream or a file, or give them to a callback.
+//
+// Traces are compiled out in release builds (i.e., if NDEBUG is defined), so
+// that no probe is left in the reader.
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DOTlexer.h"
+
+// the following macro executes the given statement only if traces are enabled
+#ifndef NDEBUG
+# define DOT_TRACE(statement) statement
+#else
+# define DOT_TRACE(statement)
+#endif
+
+namespace dot {
+
+  using namespace std;
+
+  // Struct definition
+  //
+  // Definition of the event of reading a token. Both the label and the value
+  // are views which are valid only while the event is given to a sink
+  struct trace_event {
+
+    token kind;                                         // kind of token read
+    uint64_t offset;                // offset of the token from the beginning
+    string_view label;                             // description of the token
+    string_view value;                           // value of the token, if any
+  };
+
+  // Class definition
+  //
+  // Definition of a sink of events. Events are given in batches, in the same
+  // order they were read
+  class trace_sink {
+
+  public:
+
+    // Destructor
+    virtual ~trace_sink () = default;
+
+    // take the given events
+    virtual void write (const trace_event* events, size_t nbevents) = 0;
+
+  }; // class trace_sink
+
+  // Class definition
+  //
+  // Definition of a sink which keeps the last events given in a ring buffer
+  class ring_sink : public trace_sink {
+
+  private:
+
+    // INVARIANTS: the last (at most) _capacity events are stored in _events,
+    // with their values copied in _values. The oldest one is at _first
+    vector<trace_event> _events;                           // last events given
+    vector<string> _values;                              // values of the events
+    size_t _capacity;                            // maximum number of events
+    size_t _first;                               // location of the oldest event
+
+  public:
+
+    // Explicit constructor
+    explicit ring_sink (size_t capacity);
+
+    // return the number of events stored
+    size_t size () const
+    { return _events.size (); }
+
+    // return the i-th oldest event stored. Its value is valid until the sink
+    // takes more events
+    const trace_event& operator[] (size_t i) const
+    { return _events[(_first + i) % _events.size ()]; }
+
+    // remove all events
+    void clear ();
+
+    // take the given events, overwriting the oldest ones if necessary
+    void write (const trace_event* events, size_t nbevents) override;
+
+  }; // class ring_sink
+
+  // Class definition
+  //
+  // Definition of a sink which writes events into a stream, one per line
+  // preceded by its offset. Every batch is written at once
+  class stream_sink : public trace_sink {
+
+  private:
+
+    ostream& _stream;                                  // stream being written
+    string _buffer;                                  // batch being written
+
+  public:
+
+    // Explicit constructor
+    explicit stream_sink (ostream& stream)
+      : _stream {stream}
+    {}
+
+    // write the given events into the stream
+    void write (const trace_event* events, size_t nbevents) override;
+
+  }; // class stream_sink
+
+  // Class definition
+  //
+  // Definition of a sink which writes events into a file just like a
+  // stream_sink does
+  class file_sink : public trace_sink {
+
+  private:
+
+    ofstream _file;                                      // file being written
+    stream_sink _sink;                             // sink writing the file
+
+  public:
+
+    // Explicit constructor. In case the file can not be created an exception
+    // is raised
+    explicit file_sink (const string& filename);
+
+    // write the given events into the file
+    void write (const trace_event* events, size_t nbevents) override
+    { _sink.write (events, nbevents); }
+
+  }; // class file_sink
+
+  // Class definition
+  //
+  // Definition of a sink which gives every batch of events to a callback
+  class callback_sink : public trace_sink {
+
+  private:
+
+    function<void (const trace_event*, size_t)> _callback;
+
+  public:
+
+    // Explicit constructor
+    explicit callback_sink (function<void (const trace_event*, size_t)> callback)
+      : _callback {move (callback)}
+    {}
+
+    // give the events to the callback
+    void write (const trace_event* events, size_t nbevents) override
+    { _callback (events, nbevents); }
+
+  }; // class callback_sink
+
+  // Class definition
+  //
+  // Definition of a tracer, which buffers the events of a reader and gives
+  // them to its sink in batches
+  class tracer {
+
+  public:
+
+    // whether traces are compiled in or not
+#ifndef NDEBUG
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    // default number of events given to the sink in every batch
+    static constexpr size_t batch = 1024;
+
+  private:
+
+    // INVARIANTS: events are buffered in _events until there are batch of
+    // them. Offsets are computed with respect to _base, which is at _origin
+    // bytes from the beginning of the contents. No events are buffered while
+    // _muted is true
+    trace_sink* _sink;                          // sink of the events, if any
+    vector<trace_event> _events;                       // events not given yet
+    const char* _base;                   // location of a known offset
+    uint64_t _origin;                           // offset of _base
+    bool _muted;                       // whether events are ignored or not
+
+  public:
+
+    // Default constructor
+    tracer ()
+      : _sink {nullptr},
+	_base {nullptr},
+	_origin {0},
+	_muted {false}
+    {}
+
+    // tracers can be moved, but they are not copied as they might have
+    // events pending. Note that events pending are not given to the sink when
+    // the tracer is destroyed, as their views might not be valid anymore
+    tracer (const tracer&) = delete;
+    tracer (tracer&&) = default;
+    tracer& operator= (const tracer&) = delete;
+    tracer& operator= (tracer&&) = default;
+
+    // get/set accessors
+    trace_sink* get_sink () const
+    { return _sink; }
+    bool is_active () const
+    { return enabled && _sink; }
+
+    // give all events pending to the current sink and use the given one
+    // (none if nullptr) from now on
+    void set_sink (trace_sink* sink)
+    {
+      flush ();
+      _sink = sink;
+    }
+
+    // compute the offsets of the following events with respect to the given
+    // location, which is at the given offset from the beginning of the
+    // contents
+    void set_origin (const char* base, uint64_t origin)
+    {
+      _base = base;
+      _origin = origin;
+    }
+
+    // ignore all events or stop doing so
+    void mute (bool value)
+    { _muted = value; }
+
+    // buffer the event of reading a token of the given kind at the given
+    // location
+    void emit (token kind, const char* location, string_view label, string_view value)
+    {
+      if (!_sink || _muted)
+	return;
+      _events.push_back ({kind, _origin + (location - _base), label, value});
+      if (_events.size () == batch)
+	flush ();
+    }
+
+    // return the number of events pending, and remove those after the given
+    // number. Note that events already given to the sink can not be removed
+    size_t mark () const
+    { return _events.size (); }
+    void rollback (size_t mark)
+    {
+      if (mark < _events.size ())
+	_events.resize (mark);
+    }
+
+    // give all events pending to the sink
+    void flush ()
+    {
+      if (_sink && !_events.empty ())
+	_sink->write (_events.data (), _events.size ());
+      _events.clear ();
+    }
+
+  }; // class tracer
+
+} // namespace dot
+
+#endif 	    /* !TRACE_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,212 @@
+/*
+  DOTtraversal.h
+  Description: Breadth-first and depth-first traversals of parsed graphs
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 23:18:42 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	TRAVERSAL_H_
+# define   	TRAVERSAL_H_
+
+// Graphs are traversed directly over the identifiers of the neighbours of
+// every vertex, as given by get_neighbour_range, so that no name is ever
+// looked up nor copied. Thus, the same kernels traverse parsers and snapshots
+// alike. Vertices are marked as visited in a set of vertices stored as a
+// bitset indexed by their identifiers, which takes one bit per vertex, and
+// neighbours are always visited in the same order they are given. Traversals
+// are iterative, so that they can be used with graphs of any depth.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dot {
+
+  using namespace std;
+
+  // level given to the vertices which are not reached in a breadth-first
+  // traversal
+  inline constexpr uint32_t unreached = numeric_limits<uint32_t>::max ();
+
+  // Class definition
+  //
+  // Definition of a set of vertices given by their identifiers, which is
+  // stored as a bitset
+  class vertex_set {
+
+  private:
+
+    // INVARIANTS: the i-th vertex is in the set if and only if the (i%64)-th
+    // bit of _words[i/64] is set. Only identifiers in [0, _nbvertices) can be
+    // stored, and _size bits are set
+    vector<uint64_t> _words;                          // bits of all vertices
+    size_t _nbvertices;                     // number of vertices of the graph
+    size_t _size;                            // number of vertices in the set
+
+  public:
+
+    // Explicit constructor, which creates an empty set of vertices with
+    // identifiers in [0, nbvertices)
+    explicit vertex_set (size_t nbvertices = 0)
+      : _words ((nbvertices + 63) / 64),
+	_nbvertices {nbvertices},
+	_size {0}
+    {}
+
+    // get accessors
+    size_t get_nb_vertices () const
+    { return _nbvertices; }
+
+    // return the number of vertices in the set
+    size_t size () const
+    { return _size; }
+
+    // return true if the set has no vertices
+    bool empty () const
+    { return !_size; }
+
+    // return true if the vertex with the given identifier is in the set
+    bool contains (uint32_t id) const
+    { return id < _nbvertices && (_words[id >> 6] >> (id & 63)) & 1; }
+
+    // add the vertex with the given identifier, which is not verified, and
+    // return true if it was not in the set yet
+    bool insert (uint32_t id)
+    {
+      uint64_t& word = _words[id >> 6];
+      uint64_t bit = uint64_t (1) << (id & 63);
+      if (word & bit)
+	return false;
+      word |= bit;
+      _size++;
+      return true;
+    }
+
+    // remove all vertices
+    void clear ()
+    {
+      _words.assign (_words.size (), 0);
+      _size = 0;
+    }
+
+    // return the identifiers of all vertices in the set in increasing order
+    vector<uint32_t> get_ids () const
+    {
+      vector<uint32_t> ids;
+      ids.reserve (_size);
+      for (size_t i = 0 ; i < _words.size () ; i++)
+	for (uint64_t word = _words[i] ; word ; word &= word - 1)
+	  ids.push_back (uint32_t (64 * i + __builtin_ctzll (word)));
+      return ids;
+    }
+
+  }; // class vertex_set
+
+  // the vertices visited in a depth-first traversal, both in the order they
+  // are first visited (preorder) and in the order all their descendants are
+  // visited (postorder)
+  struct dfs_order {
+    vector<uint32_t> preorder;          // vertices in the order they are found
+    vector<uint32_t> postorder;        // vertices in the order they are closed
+  };
+
+  // return the set of vertices reachable from the given source, including
+  // itself. In case no vertex is found with the given identifier an exception
+  // is raised
+  template<class Graph>
+  vertex_set reachable (const Graph& graph, uint32_t source)
+  {
+    graph.get_neighbour_range (source);
+    vertex_set visited {graph.get_nb_vertices ()};
+    vector<uint32_t> queue {source};
+    visited.insert (source);
+    for (size_t head = 0 ; head < queue.size () ; head++)
+      for (auto target : graph.get_neighbour_range (queue[head]))
+	if (visited.insert (target))
+	  queue.push_back (target);
+    return visited;
+  }
+
+  // return the level of every vertex in a breadth-first traversal from the
+  // given source, i.e., the minimum number of edges from the source, indexed
+  // by their identifiers. Vertices which are not reachable from the source
+  // are given the level unreached. In case no vertex is found with the given
+  // identifier an exception is raised
+  template<class Graph>
+  vector<uint32_t> bfs_levels (const Graph& graph, uint32_t source)
+  {
+    graph.get_neighbour_range (source);
+    vector<uint32_t> levels (graph.get_nb_vertices (), unreached);
+    vertex_set visited {graph.get_nb_vertices ()};
+    vector<uint32_t> queue {source};
+    visited.insert (source);
+    levels[source] = 0;
+    for (size_t head = 0 ; head < queue.size () ; head++) {
+      uint32_t vertex = queue[head];
+      for (auto target : graph.get_neighbour_range (vertex))
+	if (visited.insert (target)) {
+	  levels[target] = levels[vertex] + 1;
+	  queue.push_back (target);
+	}
+    }
+    return levels;
+  }
+
+  // return the vertices reachable from the given source in the preorder and
+  // postorder of a depth-first traversal, precisely as a recursive traversal
+  // does. In case no vertex is found with the given identifier an exception
+  // is raised
+  template<class Graph>
+  dfs_order dfs (const Graph& graph, uint32_t source)
+  {
+
+    // every vertex in the stack is given along with the neighbours not
+    // visited yet
+    struct frame {
+      uint32_t vertex;
+      const uint32_t* next;
+      const uint32_t* last;
+    };
+    auto neighbours = graph.get_neighbour_range (source);
+    vector<frame> stack {{source, neighbours.begin (), neighbours.end ()}};
+    vertex_set visited {graph.get_nb_vertices ()};
+    visited.insert (source);
+    dfs_order order;
+    order.preorder.push_back (source);
+
+    while (!stack.empty ()) {
+
+      // once all neighbours have been visited, the vertex is closed
+      frame& top = stack.back ();
+      if (top.next == top.last) {
+	order.postorder.push_back (top.vertex);
+	stack.pop_back ();
+	continue;
+      }
+
+      // otherwise, proceed with the next neighbour unless it was visited
+      uint32_t target = *top.next++;
+      if (visited.insert (target)) {
+	order.preorder.push_back (target);
+	neighbours = graph.get_neighbour_range (target);
+	stack.push_back ({target, neighbours.begin (), neighbours.end ()});
+      }
+    }
+    return order;
+  }
+
+} // namespace dot
+
+#endif 	    /* !TRAVERSAL_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,184 @@
+/*
+  DOTvalue.h
+  Description: Typed values of labels and attributes
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 14:36:20 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	VALUE_H_
+# define   	VALUE_H_
+
+// Values of labels and attributes are decoded only once, when they are
+// stored. Those which are integer numbers (which fit in 64 bits) or
+// floating-point numbers, as recognized by the regular expressions
+// ATTRIBUTE_VALUE_END and LABEL_VALUE, are stored along with their number,
+// so that they can be retrieved with any arithmetic type without parsing them
+// again. The text of all values is kept as well. Note that double quotes are
+// removed by the reader, so that quoted numbers are numbers as well.
+
+#include <charconv>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a typed value
+  class value {
+
+  public:
+
+    // kinds of values
+    enum class kind : unsigned char { string, integer, floating };
+
+    // values take the memory of their text from a memory resource, so that
+    // they are constructed with the allocator of the containers they are
+    // stored in
+    using allocator_type = pmr::polymorphic_allocator<char>;
+
+  private:
+
+    // INVARIANTS: every value has a text and a kind. If it is a number, it is
+    // also stored in either _integer or _floating
+    pmr::string _text;                               // text of this value
+    kind _kind;                                          // kind of this value
+    union {
+      int64_t _integer;
+      double _floating;
+    };
+
+    // return true if the given text is a number, i.e., it consists of an
+    // optional sign, a sequence of digits with at most one decimal point and
+    // at least one digit, and an optional exponent. If so, integral is true
+    // if it has neither a decimal point nor an exponent
+    static bool _is_number (string_view text, bool& integral)
+    {
+      auto isdigit = [] (char c) { return c >= '0' && c <= '9'; };
+      size_t i = 0, nbdigits = 0;
+      if (i < text.size () && (text[i] == '+' || text[i] == '-'))
+	i++;
+      for ( ; i < text.size () && isdigit (text[i]) ; i++, nbdigits++);
+      integral = true;
+      if (i < text.size () && text[i] == '.') {
+	integral = false;
+	for (i++ ; i < text.size () && isdigit (text[i]) ; i++, nbdigits++);
+      }
+      if (!nbdigits)
+	return false;
+      if (i < text.size () && (text[i] == 'e' || text[i] == 'E')) {
+	integral = false;
+	if (++i < text.size () && (text[i] == '+' || text[i] == '-'))
+	  i++;
+	if (i == text.size () || !isdigit (text[i]))
+	  return false;
+	for ( ; i < text.size () && isdigit (text[i]) ; i++);
+      }
+      return i == text.size ();
+    }
+
+    // decode the text of this value
+    void _decode ()
+    {
+      _kind = kind::string;
+      bool integral;
+      if (!_is_number (_text, integral))
+	return;
+
+      // from_chars does not accept a leading plus sign. Integers which do not
+      // fit in 64 bits are stored as floating-point numbers
+      const char* first = _text.data () + (_text[0] == '+');
+      const char* last = _text.data () + _text.size ();
+      if (integral && from_chars (first, last, _integer).ec == errc ())
+	_kind = kind::integer;
+      else if (from_chars (first, last, _floating).ec == errc ())
+	_kind = kind::floating;
+    }
+
+    // copy the number of the given value, if any
+    void _copy_number (const value& other)
+    {
+      if (_kind == kind::integer)
+	_integer = other._integer;
+      else if (_kind == kind::floating)
+	_floating = other._floating;
+    }
+
+  public:
+
+    // Explicit constructor
+    value (string_view text = string_view (), const allocator_type& allocator = {})
+      : _text {text, allocator}
+    { _decode (); }
+
+    // values can be copied and moved, either with the same allocator or
+    // another one
+    value (const value& other, const allocator_type& allocator = {})
+      : _text {other._text, allocator},
+	_kind {other._kind}
+    { _copy_number (other); }
+    value (value&& other) = default;
+    value (value&& other, const allocator_type& allocator)
+      : _text {std::move (other._text), allocator},
+	_kind {other._kind}
+    { _copy_number (other); }
+    value& operator= (const value&) = default;
+    value& operator= (value&&) = default;
+
+    // assign the given text to this value
+    value& operator= (string_view text)
+    {
+      _text = text;
+      _decode ();
+      return *this;
+    }
+
+    // get accessors
+    kind get_kind () const
+    { return _kind; }
+    string_view get_text () const
+    { return _text; }
+    bool is_number () const
+    { return _kind != kind::string; }
+
+    // return this value with the given type, which is either a string (or a
+    // view) or an arithmetic type. Numbers can be retrieved with any
+    // arithmetic type, but an exception is raised if this value is not a
+    // number
+    template<class T>
+    T get () const
+    {
+      if constexpr (is_same_v<T, string> || is_same_v<T, string_view>)
+	return T (_text);
+      else {
+	static_assert (is_arithmetic_v<T>, "values can only be retrieved as strings or numbers");
+	if (_kind == kind::integer)
+	  return T (_integer);
+	if (_kind == kind::floating)
+	  return T (_floating);
+	throw invalid_argument ("the value '" + string (_text) + "' is not a number");
+      }
+    }
+
+  }; // class value
+
+} // namespace dot
+
+#endif 	    /* !VALUE_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,287 @@
+/*
+  DOTview.cc
+  Description: Dot language parser whose results are views over its contents
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 18:02:27 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <stdexcept>
+
+#include "DOTview.h"
+
+// Private services
+// ----------------------------------------------------------------------------
+
+// remove all the contents and the graph parsed from them
+void dot::view::_clear ()
+{
+
+  // first, remove all views and then the contents they refer to
+  _type = _name = string_view ();
+  _graph.clear ();
+  _label.clear ();
+  _vertex.clear ();
+  _edge.clear ();
+  _edges.clear ();
+  _contents = string_view ();
+  _input.close ();
+  _buffer.clear ();
+}
+
+// parse the contents stored in _contents
+bool dot::view::_parse ()
+{
+  reader reader;
+  if (_trace)
+    reader.set_trace (_trace);
+  else
+    reader.set_verbose (_verbose);
+  return reader.parse_string (_contents, *this);
+}
+
+// merge the given attributes into dict, so that the values already stored
+// prevail. If an attribute is given more than once, the last value is taken
+//
+// Attributes are traversed backwards, so that only the last value of every
+// attribute is inserted, and only if it was not stored yet
+void dot::view::_merge (map<string_view, string_view>& dict, const attributes& attrs)
+{
+  for (auto iattr = attrs.rbegin () ; iattr != attrs.rend () ; ++iattr)
+    dict.try_emplace (iattr->first, iattr->second);
+}
+
+// the header of the graph
+void dot::view::graph (string_view type, string_view name)
+{
+  _type = type;
+  _name = name;
+}
+
+// a label with its value
+void dot::view::label (string_view name, string_view value)
+{
+  _label[name] = value;
+}
+
+// a node statement
+void dot::view::vertex (string_view name)
+{
+
+  // just record this vertex with no neighbours unless it was already inserted
+  _graph.try_emplace (name);
+}
+
+// the attributes of a vertex
+void dot::view::vertex_attributes (string_view name, const attributes& attrs)
+{
+  _merge (_vertex[name], attrs);
+}
+
+// an edge, either directed or undirected. The edge orig->target is added and,
+// if the arc is undirected, also the edge target->orig. Finally, target is
+// added to the graph even if it has no neighbours
+void dot::view::edge (string_view orig, string_view target, bool directed)
+{
+
+  // make sure this target vertex was not processed before
+  if (_edges.emplace (orig, target).second)
+    _graph[orig].push_back (target);
+
+  // if the edge is undirected, then add the edge in the opposite direction as
+  // well. Otherwise, add the target vertex even if it has no neighbours
+  vector<string_view>& reversed = _graph[target];
+  if (!directed && _edges.emplace (target, orig).second)
+    reversed.push_back (orig);
+}
+
+// the attributes of an edge, which are annotated in both directions if the edge
+// is undirected
+void dot::view::edge_attributes (string_view orig, string_view target, bool directed,
+				 const attributes& attrs)
+{
+  _merge (_edge[orig][target], attrs);
+  if (!directed)
+    _merge (_edge[target][orig], attrs);
+}
+
+// return the attributes of the edge (origin,target), or nullptr if it has
+// none. If either the origin does not exist, or the target is not found to be a
+// neighbour of the origin, an exception is raised
+const std::map<std::string_view, std::string_view>* dot::view::_get_edge (string_view origin,
+									  string_view target) const
+{
+
+  // verify that the target is reachable from the origin
+  if (_graph.find (origin) == _graph.end ())
+    throw dot::syntax_error (" No node with the name '" + string (origin) + "' has been found");
+  if (!_edges.count ({origin, target}))
+    throw dot::syntax_error (" The node '" + string (origin) + "' has no neighbour with the name '" + string (target) + "'");
+
+  // and return the attributes of this edge, if any
+  auto iattrs = _edge.find (origin);
+  if (iattrs == _edge.end ())
+    return nullptr;
+  auto jattrs = iattrs->second.find (target);
+  return jattrs == iattrs->second.end () ? nullptr : &jattrs->second;
+}
+
+// Public services
+// ----------------------------------------------------------------------------
+
+// get all labels of this graph
+std::vector<std::string_view> dot::view::get_labels () const
+{
+  vector<string_view> labels;
+  for (auto& ilabel : _label)
+    labels.push_back (ilabel.first);
+  return labels;
+}
+
+// get the value of the label with the specified name
+std::string_view dot::view::get_label_value (string_view name) const
+{
+
+  // verify that the specified label actually exists
+  auto ilabel = _label.find (name);
+  if (ilabel == _label.end ())
+    throw dot::syntax_error (" No label with the name '" + string (name) + "' has been found");
+
+  // otherwise return the value of this label
+  return ilabel->second;
+}
+
+// get all source vertices of the graph
+std::vector<std::string_view> dot::view::get_vertices () const
+{
+  vector<string_view> vertices;
+  for (auto& ivertex : _graph)
+    vertices.push_back (ivertex.first);
+  return vertices;
+}
+
+// return the graph parsed as a map where the index is a source vertex and
+// the value is a vector of target vertices. As in the dot parser, vertices with
+// no neighbours are not returned
+std::map<std::string_view, std::vector<std::string_view>> dot::view::get_graph () const
+{
+  map<string_view, vector<string_view>> graph;
+  for (auto& vertex : _graph)
+    if (vertex.second.size () > 0)
+      graph [vertex.first] = vertex.second;
+  return graph;
+}
+
+// get all nodes that are reachable from a given node. In case no node is found
+// with the given node an exception is raised.
+const std::vector<std::string_view>& dot::view::get_neighbours (string_view name) const
+{
+
+  // verify that the specified name actually exists
+  auto ivertex = _graph.find (name);
+  if (ivertex == _graph.end ())
+    throw dot::syntax_error (" No node with the name '" + string (name) + "' has been found");
+
+  // otherwise return a vector with all neighbours of this node
+  return ivertex->second;
+}
+
+// get all the attributes of the specified vertex. In case no node is found with
+// the given node an exception is raised.
+std::map<std::string_view, std::string_view> dot::view::get_vertex_attributes (string_view name) const
+{
+
+  // verify that the specified name actually exists
+  if (_graph.find (name) == _graph.end ())
+    throw dot::syntax_error (" No node with the name '" + string (name) + "' has been found");
+
+  // and return its attributes, if any
+  auto iattrs = _vertex.find (name);
+  if (iattrs == _vertex.end ())
+    return map<string_view, string_view>();
+  return iattrs->second;
+}
+
+// return the value of an attribute defined for a specific vertex. In case no
+// node is found with the given node, or no attribute with the given name is
+// found for the specified node, an exception is raised.
+std::string_view dot::view::get_vertex_attribute (string_view name, string_view attrname) const
+{
+
+  // verify that the specified name actually exists
+  if (_graph.find (name) == _graph.end ())
+    throw dot::syntax_error (" No node with the name '" + string (name) + "' has been found");
+
+  // verify there is an attribute with the given name
+  auto iattrs = _vertex.find (name);
+  if (iattrs == _vertex.end () || iattrs->second.find (attrname) == iattrs->second.end ())
+    throw dot::syntax_error (" The node '" + string (name) + "' has no attribute with the name '" + string (attrname) + "'");
+
+  return iattrs->second.find (attrname)->second;
+}
+
+// get all the attributes of a specific edge qualified by its (origin,target)
+// names. If either the origin does not exist, or the target is not found to be
+// a neighbour of the origin, an exception is raised.
+std::map<std::string_view, std::string_view> dot::view::get_edge_attributes (string_view origin,
+									     string_view target) const
+{
+  const map<string_view, string_view>* attrs = _get_edge (origin, target);
+  return attrs ? *attrs : map<string_view, string_view>();
+}
+
+// return the value of the given attribute defined for the edge qualified by
+// (origin,target) names. If either the origin does not exist, or the target is
+// not found to be a neighbour of the origin, or the edge has attributes but
+// none with the given name, an exception is raised. Edges with no attributes at
+// all have an empty value for every attribute
+std::string_view dot::view::get_edge_attribute (string_view origin,
+						string_view target,
+						string_view attrname) const
+{
+
+  // verify that the edge exists and retrieve its attributes
+  const map<string_view, string_view>* attrs = _get_edge (origin, target);
+  if (!attrs || attrs->empty ())
+    return string_view ();
+
+  // in case the edge has attributes but none with the specified name, raise an
+  // exception
+  auto iattr = attrs->find (attrname);
+  if (iattr == attrs->end ())
+    throw dot::syntax_error (" The edge joining vertices '" + string (origin) + "' and '" + string (target) + "' has no attribute named '" + string (attrname) + "'");
+  return iattr->second;
+}
+
+// parse the file given in the explicit constructor of this instance, which is
+// mapped into memory if possible. It returns true if the file could be
+// successfully parse. Otherwise, it raises an exception with an error message
+bool dot::view::parse ()
+{
+  _clear ();
+  if (!_input.open (_filename))
+    throw invalid_argument ("file not found '" + _filename + "'");
+  _contents = _input.get_contents ();
+  return _parse ();
+}
+
+// parse the given string, which is owned by this view from now on. It returns
+// true if the string could be successfully parse. Otherwise, it raises an
+// exception with an error message
+bool dot::view::parse_string (string contents)
+{
+  _clear ();
+  _buffer = std::move (contents);
+  _contents = _buffer;
+  return _parse ();
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,223 @@
+/*
+  DOTview.h
+  Description: Dot language parser whose results are views over its contents
+  -----------------------------------------------------------------------------
+
+  Started on  <Fri Oct 16 18:02:27 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	VIEW_H_
+# define   	VIEW_H_
+
+// A view parses a graph just like the dot parser does and provides the same
+// services. However, it owns the contents being parsed (either a file mapped
+// into memory or a string), and all names and values are stored as views over
+// them, so that no string is ever copied. Note that quoted strings have no
+// escape sequences in the subset of the dot language acknowledged, so that
+// every name and value is just a part of the contents.
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DOTinput.h"
+#include "DOTreader.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a parser whose results are views over its contents
+  class view {
+
+  private:
+
+    // INVARIANTS: every view owns the contents it parses, which are either
+    // the file given in the explicit constructor (mapped into memory if
+    // possible) or the string given to parse_string. All names and values
+    // stored below are views over them, so that views can be neither copied
+    // nor moved
+    string _filename;           // filename with the dot specification to parse
+    input _input;                                   // contents of the file
+    string _buffer;                                 // contents of the string
+    string_view _contents;                        // contents being parsed
+
+    // the graph is stored precisely in the same way than in the dot parser,
+    // but with views instead of strings
+    string_view _type;             // graph type, either directed or undirected
+    string_view _name;         // graph name which can be also the empty string
+    map<string_view, vector<string_view>> _graph;
+    map<string_view, string_view> _label;
+    map<string_view, map<string_view, string_view>> _vertex;
+    map<string_view, map<string_view, map<string_view, string_view>>> _edge;
+
+    // all edges are indexed by the names of their vertices, so that repeated
+    // edges are detected in constant time, just like in the dot parser
+    struct edge_hash {
+      size_t operator() (const pair<string_view, string_view>& edge) const
+      {
+	size_t hash = std::hash<string_view> () (edge.first);
+	return hash ^ (std::hash<string_view> () (edge.second) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+      }
+    };
+    unordered_set<pair<string_view, string_view>, edge_hash> _edges;
+
+    // Additionally, the user can explicitly request verbose output while
+    // parsing the dot specification file, or a trace of the tokens read. Both
+    // are disabled by default
+    bool _verbose;                     // whether the user wants verbose output
+    trace_sink* _trace;                          // sink of the trace, if any
+
+    // the contents are read by a reader which notifies them to this view
+    friend class reader;
+    friend class recorder;
+
+  private:
+
+    // remove all the contents and the graph parsed from them
+    void _clear ();
+
+    // parse the contents stored in _contents
+    bool _parse ();
+
+    // merge the given attributes into dict, so that the values already stored
+    // prevail. If an attribute is given more than once, the last value is
+    // taken
+    static void _merge (map<string_view, string_view>& dict, const attributes& attrs);
+
+    // return the attributes of the edge (origin,target), or nullptr if it has
+    // none. If either the origin does not exist, or the target is not found
+    // to be a neighbour of the origin, an exception is raised
+    const map<string_view, string_view>* _get_edge (string_view origin, string_view target) const;
+
+    // the following methods store the contents notified by the reader in the
+    // same way the dot parser does
+    void graph (string_view type, string_view name);
+    void label (string_view name, string_view value);
+    void vertex (string_view name);
+    void vertex_attributes (string_view name, const attributes& attrs);
+    void edge (string_view orig, string_view target, bool directed);
+    void edge_attributes (string_view orig, string_view target, bool directed,
+			  const attributes& attrs);
+
+  public:
+
+    // Default constructor
+    view ()
+      : _filename {""},
+	_verbose {false},
+	_trace {nullptr}
+    {}
+
+    // Explicit constructor
+    explicit view (const string& filename)
+      : _filename {filename},
+	_verbose {false},
+	_trace {nullptr}
+    {}
+
+    // views can be neither copied nor moved
+    view (const view&) = delete;
+    view& operator= (const view&) = delete;
+
+    // get/set accessors
+    string_view get_contents () const
+    { return _contents; }
+    string_view get_type () const
+    { return _type; }
+    string_view get_name () const
+    { return _name; }
+
+    // get all labels of this graph
+    vector<string_view> get_labels () const;
+
+    // get the value of the label with the specified name
+    string_view get_label_value (string_view name) const;
+
+    // get all source vertices of the graph
+    vector<string_view> get_vertices () const;
+
+    // return the graph parsed as a map where the index is a source vertex and
+    // the value is a vector of target vertices.
+    map<string_view, vector<string_view>> get_graph () const;
+
+    // get all nodes that are reachable from a given node. In case no node is
+    // found with the given node an exception is raised.
+    const vector<string_view>& get_neighbours (string_view name) const;
+
+    // get all attributes of all vertices of the graph
+    const map<string_view, map<string_view, string_view>>& get_all_vertex_attributes () const
+    { return _vertex; }
+
+    // get all the attributes of the specified vertex. In case no node is found
+    // with the given node an exception is raised.
+    map<string_view, string_view> get_vertex_attributes (string_view name) const;
+
+    // return the value of an attribute defined for a specific vertex. In case
+    // no node is found with the given node, or no attribute with the given name
+    // is found for the specified node, an exception is raised.
+    string_view get_vertex_attribute (string_view name, string_view attrname) const;
+
+    // get the edge attributes for all edges in the graph that have any
+    const map<string_view, map<string_view, map<string_view, string_view>>>& get_all_edge_attributes () const
+    { return _edge; }
+
+    // get all the attributes of a specific edge qualified by its
+    // (origin,target) names. If either the origin does not exist, or the target
+    // is not found to be a neighbour of the origin, an exception is raised.
+    map<string_view, string_view> get_edge_attributes (string_view origin, string_view target) const;
+
+    // return the value of the given attribute defined for the edge qualified
+    // by (origin,target) names. If either the origin does not exist, or the
+    // target is not found to be a neighbour of the origin, or the edge has
+    // attributes but none with the given name, an exception is raised. Edges
+    // with no attributes at all have an empty value for every attribute, just
+    // like in the dot parser
+    string_view get_edge_attribute (string_view origin, string_view target, string_view attrname) const;
+
+    // Sets the verbose level to true by default
+    void set_verbose (bool value = true)
+    {
+      _verbose = value;
+      _trace = nullptr;
+    }
+
+    // trace all tokens read with the given sink, or disable the trace if none
+    // is given, just like parsers do
+    void set_trace (trace_sink* sink)
+    {
+      _trace = sink;
+      _verbose = false;
+    }
+
+    // parse the file given in the explicit constructor of this instance, which
+    // is mapped into memory if possible. It returns true if the file could be
+    // successfully parse. Otherwise, it raises an exception with an error
+    // message
+    bool parse ();
+
+    // parse the given string, which is owned by this view from now on. It
+    // returns true if the string could be successfully parse. Otherwise, it
+    // raises an exception with an error message
+    bool parse_string (string contents);
+
+  };  // class view
+
+} // namespace dot
+
+#endif 	    /* !VIEW_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,209 @@
+/*
+  DOTwriter.cc
+  Description: Serialization of parsed graphs in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 22:24:51 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#include <fstream>
+#include <stdexcept>
+
+#include "DOTlexer.h"
+#include "DOTwriter.h"
+
+namespace {
+
+  // return true if both attributes have the same names and values
+  bool equal (const dot::parser::attribute_map& first,
+	      const dot::parser::attribute_map& second)
+  {
+    if (first.size () != second.size ())
+      return false;
+    for (auto ifirst = first.begin (), isecond = second.begin () ;
+	 ifirst != first.end () ; ++ifirst, ++isecond)
+      if (ifirst->first != isecond->first ||
+	  ifirst->second.get_text () != isecond->second.get_text ())
+	return false;
+    return true;
+  }
+
+  // return true if the given text can be given between double quotes as the
+  // value of an attribute, i.e., if all its double quotes come in pairs, so
+  // that it is read as a sequence of quoted strings
+  bool is_quoted_attribute_value (std::string_view text)
+  {
+    for (size_t i = 0 ; i < text.size () ; i++)
+      if (text[i] == '"' && (++i == text.size () || text[i] != '"'))
+	return false;
+    return true;
+  }
+
+} // namespace
+
+namespace dot {
+
+  // write the given value of an attribute or a label, with double quotes if
+  // necessary. Quoted values of labels are taken up to the last double quote
+  // in the same line, so that they can contain double quotes but no line
+  // terminators
+  void writer::_put_value (string_view text, bool label)
+  {
+    if (label ? lexer::is_label_value (text) : lexer::is_attribute_value (text)) {
+      _output.put (text);
+      return;
+    }
+    if (label ? text.find_first_of ("\n\r") != string_view::npos
+	: !is_quoted_attribute_value (text))
+      throw invalid_argument ("the value '" + string (text) + "' can not be written in the DOT language");
+    _output.put ('"');
+    _output.put (text);
+    _output.put ('"');
+  }
+
+  // write the given attributes between square brackets (if any)
+  void writer::_put_attributes (const parser::attribute_map& attrs)
+  {
+    if (attrs.empty ())
+      return;
+    _pretty (" ");
+    _output.put ('[');
+    for (auto iattr = attrs.begin () ; iattr != attrs.end () ; ++iattr) {
+      if (iattr != attrs.begin ()) {
+	_output.put (',');
+	_pretty (" ");
+      }
+      _output.put (iattr->first);
+      _output.put ('=');
+      _put_value (iattr->second.get_text (), false);
+    }
+    _output.put (']');
+  }
+
+  // write all edges of the given vertex of the given graph, in the same order
+  // than its neighbours. In undirected graphs, edges given in both directions
+  // with the same attributes are written only once, from the vertex with the
+  // lowest identifier
+  void writer::_put_edges (const parser& graph, uint32_t origin, bool undirected)
+  {
+
+    // return the operator of the edge from the origin to the given target, or
+    // an empty view if it has been written already
+    auto edgeop = [&] (uint32_t target) {
+      if (!undirected || !graph._edges.count (parser::_edge_key (target, origin)) ||
+	  !equal (graph._get_edge_attribute_map (origin, target),
+		  graph._get_edge_attribute_map (target, origin)))
+	return string_view ("->");
+      return (target < origin) ? string_view () : string_view ("--");
+    };
+
+    const auto& neighbours = graph._graph[origin];
+    for (size_t i = 0 ; i < neighbours.size () ; ) {
+      string_view op = edgeop (neighbours[i]);
+      if (op.empty ()) {
+	i++;
+	continue;
+      }
+
+      // in the compact layout, consecutive targets with no attributes and the
+      // same operator are written in a block of multiple targets
+      const auto& attrs = graph._get_edge_attribute_map (origin, neighbours[i]);
+      size_t last = i + 1;
+      if (_layout == layout::compact && attrs.empty ())
+	while (last < neighbours.size () &&
+	       graph._get_edge_attribute_map (origin, neighbours[last]).empty () &&
+	       edgeop (neighbours[last]) == op)
+	  last++;
+
+      _pretty ("\t");
+      _output.put (graph._ids.get_name (origin));
+      _pretty (" ");
+      _output.put (op);
+      _put_attributes (attrs);
+      _pretty (" ");
+      if (last - i > 1)
+	_output.put ('{');
+      for (size_t j = i ; j < last ; j++) {
+	if (j > i)
+	  _output.put (' ');
+	_output.put (graph._ids.get_name (neighbours[j]));
+      }
+      if (last - i > 1)
+	_output.put ('}');
+      _output.put (";\n");
+      i = last;
+    }
+  }
+
+  // write the given graph into the given stream and return the number of
+  // bytes written
+  uint64_t writer::write (const parser& graph, ostream& stream)
+  {
+    if (graph._type.empty ())
+      throw invalid_argument ("there is no graph to write");
+
+    _output.open (stream);
+    bool undirected = (graph._type == "graph");
+
+    // the header of the graph
+    _output.put (graph._type);
+    if (!graph._name.empty ()) {
+      _output.put (' ');
+      _output.put (graph._name);
+    }
+    _pretty (" ");
+    _output.put ("{\n");
+
+    // next, all labels
+    for (auto& ilabel : graph._label) {
+      _pretty ("\t");
+      _output.put (ilabel.first);
+      _pretty (" ");
+      _output.put ('=');
+      _pretty (" ");
+      _put_value (ilabel.second.get_text (), true);
+      _output.put (";\n");
+    }
+
+    // declare all vertices with their attributes, so that they are given the
+    // same identifiers when the output is parsed
+    for (uint32_t id = 0 ; id < graph._graph.size () ; id++) {
+      _pretty ("\t");
+      _output.put (graph._ids.get_name (id));
+      _put_attributes (graph._vertex[id]);
+      _output.put (";\n");
+    }
+
+    // and finally all edges
+    for (uint32_t id = 0 ; id < graph._graph.size () ; id++)
+      _put_edges (graph, id, undirected);
+    _output.put ("}\n");
+
+    // and write the output pending
+    uint64_t nbbytes = _output.close ();
+    if (!stream)
+      throw invalid_argument ("the graph could not be written");
+    return nbbytes;
+  }
+
+  // write the given graph into the given file and return the number of bytes
+  // written
+  uint64_t writer::write (const parser& graph, const string& filename)
+  {
+    ofstream stream (filename, ios::binary);
+    if (!stream)
+      throw invalid_argument ("the file '" + filename + "' could not be created");
+    return write (graph, stream);
+  }
+
+} // namespace dot
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,114 @@
+/*
+  DOTwriter.h
+  Description: Serialization of parsed graphs in the DOT language
+  -----------------------------------------------------------------------------
+
+  Started on  <Sat Oct 17 22:24:51 2026 Carlos Linares Lopez>
+  -----------------------------------------------------------------------------
+
+  Made by Carlos Linares Lopez
+  Login   <clinares@atlas>
+*/
+
+#ifndef   	WRITER_H_
+# define   	WRITER_H_
+
+// Graphs held by a parser are written in the DOT language, so that parsing the
+// output gives precisely the same graph: the same type, name and labels, the
+// same vertices with the same identifiers and attributes and the same edges
+// with the same attributes. First, every vertex is declared in a node
+// statement in increasing order of their identifiers, and then the edges of
+// every vertex are written in the same order than its neighbours. Edges are
+// undirected only in undirected graphs, and only if they are given in both
+// directions with the same attributes. Otherwise, they are directed, so that
+// neighbours are kept in the same order in directed graphs.
+//
+// Values are written with double quotes only if they are neither numbers nor
+// identifiers, as recognized by the lexer. The output is written into a large
+// buffer which is flushed to the stream whenever it is full, so that nothing
+// is allocated per vertex or edge. Graphs can be written in a pretty layout,
+// with one statement per line, indentation and blanks around the operators, or
+// in a compact layout with no blanks but those required, where consecutive
+// neighbours with no attributes are written in blocks of multiple targets.
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "DOToutput.h"
+#include "DOTparser.h"
+
+namespace dot {
+
+  using namespace std;
+
+  // Class definition
+  //
+  // Definition of a writer of graphs in the DOT language
+  class writer {
+
+  public:
+
+    // layouts of the output
+    enum class layout : unsigned char { compact, pretty };
+
+  private:
+
+    // INVARIANTS: the output is written with a buffer which is allocated only
+    // once, and reused every time a graph is written
+    layout _layout;                                    // layout of the output
+    output _output;                                     // output being written
+
+    // write the given text if the layout is pretty
+    void _pretty (string_view text)
+    {
+      if (_layout == layout::pretty)
+	_output.put (text);
+    }
+
+    // write the given value of an attribute or a label, with double quotes if
+    // necessary. In case it can not be written in the DOT language an
+    // exception is raised
+    void _put_value (string_view text, bool label);
+
+    // write the given attributes between square brackets (if any)
+    void _put_attributes (const parser::attribute_map& attrs);
+
+    // write all edges of the given vertex of the given graph
+    void _put_edges (const parser& graph, uint32_t origin, bool undirected);
+
+  public:
+
+    // Explicit constructor
+    explicit writer (layout layout = layout::pretty)
+      : _layout {layout}
+    {}
+
+    // get/set accessors
+    layout get_layout () const
+    { return _layout; }
+    void set_layout (layout layout)
+    { _layout = layout; }
+
+    // write the given graph into the given stream and return the number of
+    // bytes written. In case a value can not be written in the DOT language
+    // or the stream can not be written an exception is raised
+    uint64_t write (const parser& graph, ostream& stream);
+
+    // write the given graph into the given file and return the number of
+    // bytes written. In case the file can not be written an exception is
+    // raised
+    uint64_t write (const parser& graph, const string& filename);
+
+  }; // class writer
+
+} // namespace dot
+
+#endif 	    /* !WRITER_H_ */
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,97 @@
+/*
+  TSTbatch.cc
+  Description: DOTbatch unit test cases
+  Started on  <Sat Oct 17 11:58:16 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that many files with very different sizes are parsed in parallel
+// precisely in the same way than sequentially, and that results are returned in
+// the same order than the files
+// ----------------------------------------------------------------------------
+TEST (Batch, RandomFiles)
+{
+  srand (time (nullptr));
+
+  // create many random graphs, a few of them much larger than the others
+  vector<string> filenames;
+  vector<string> contents;
+  for (auto i = 0 ; i < 4 * NB_TESTS ; i++) {
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    int size = (i % 10) ? 10 : 100 + rand () % 100;
+    contents.push_back (randGraph (size, 50, 5, size, 10, 1 + rand () % 5, 4, 4, randString (10),
+				   rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				   vertices, edges, labels, vertexattrs, edgeattrs));
+    filenames.push_back (writeTemporaryFile (contents.back ()));
+    ASSERT_NE ("", filenames.back ());
+  }
+
+  for (auto nbthreads : {0, 1, 3, 8}) {
+    vector<dot::parse_result> results = dot::parse_many (filenames, nbthreads);
+    ASSERT_EQ (filenames.size (), results.size ());
+    for (size_t i = 0 ; i < filenames.size () ; i++) {
+      ASSERT_EQ (filenames[i], results[i].filename);
+      ASSERT_TRUE (results[i].success ()) << results[i].get_error_message () << endl;
+      ASSERT_EQ ("", results[i].get_error_message ());
+
+      dot::parser expected;
+      expected.parse_string (contents[i]);
+      ASSERT_EQ (expected.get_name (), results[i].graph.get_name ());
+      ASSERT_EQ (expected.get_graph (), results[i].graph.get_graph ());
+      ASSERT_EQ (expected.get_all_vertex_attributes (), results[i].graph.get_all_vertex_attributes ());
+      ASSERT_EQ (expected.get_all_edge_attributes (), results[i].graph.get_all_edge_attributes ());
+    }
+  }
+
+  for (auto& filename : filenames)
+    remove (filename.c_str ());
+}
+
+// Checks that errors are reported for every file, without preventing the
+// others from being parsed
+// ----------------------------------------------------------------------------
+TEST (Batch, Errors)
+{
+  string good = writeTemporaryFile ("digraph G {\n a -> b;\n}\n");
+  string bad = writeTemporaryFile ("digraph G {\n a -> ;\n}\n");
+  vector<string> filenames {"/this/file/does/not/exist.dot", good, bad, good};
+
+  vector<dot::parse_result> results = dot::parse_many (filenames, 2);
+  ASSERT_EQ (4, results.size ());
+  EXPECT_FALSE (results[0].success ());
+  EXPECT_THROW (rethrow_exception (results[0].error), invalid_argument);
+  EXPECT_TRUE (results[1].success ());
+  EXPECT_EQ (vector<string> {"b"}, results[1].graph.get_neighbours ("a"));
+  EXPECT_FALSE (results[2].success ());
+  EXPECT_THROW (rethrow_exception (results[2].error), dot::syntax_error);
+  EXPECT_NE ("", results[2].get_error_message ());
+  EXPECT_TRUE (results[3].success ());
+
+  EXPECT_TRUE (dot::parse_many (vector<string> ()).empty ());
+
+  remove (good.c_str ());
+  remove (bad.c_str ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,137 @@
+/*
+  TSTcolumns.cc
+  Description: DOTcolumns unit test cases
+  Started on  <Sat Oct 17 16:10:27 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Verify that the i-th element of the given column has the given attributes
+void equalElement (const dot::column& column, size_t i,
+		   const map<string, string>& attrs, const string& name)
+{
+  auto iattr = attrs.find (name);
+  ASSERT_EQ (iattr != attrs.end (), column.has_value (i));
+  ASSERT_EQ (iattr == attrs.end () ? "" : iattr->second, column.get_text (i));
+  ASSERT_EQ (column.is_number (i), !isnan (column.get_numbers ()[i]));
+  ASSERT_EQ (column.has_value (i), bool ((column.get_presence ()[i / 64] >> (i % 64)) & 1));
+  if (column.is_number (i))
+    ASSERT_EQ (stod (iattr->second), column.get_number (i));
+}
+
+// Checks that graphs with no attributes have no columns
+// ----------------------------------------------------------------------------
+TEST (Columns, Empty)
+{
+  dot::parser parser;
+  parser.parse_string ("graph G {\n a -- b;\n}\n");
+  dot::columns vertices = parser.get_vertex_columns ();
+  EXPECT_EQ (2, vertices.size ());
+  EXPECT_EQ (0, vertices.get_nb_columns ());
+  EXPECT_FALSE (vertices.has_column ("color"));
+  EXPECT_THROW (vertices.get_column ("color"), out_of_range);
+  dot::columns edges = parser.get_edge_columns ();
+  EXPECT_EQ (2, edges.size ());
+  EXPECT_EQ (0, edges.get_nb_columns ());
+}
+
+// Checks that the attributes of all vertices and edges of random graphs are
+// the same in columns and in the parser
+// ----------------------------------------------------------------------------
+TEST (Columns, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::parser parser;
+    parser.parse_string (dotgraph);
+
+    // vertices are indexed by their identifiers
+    dot::columns vertexcols = parser.get_vertex_columns ();
+    ASSERT_EQ (parser.get_nb_vertices (), vertexcols.size ());
+    for (auto& name : vertexcols.get_names ()) {
+      const dot::column& column = vertexcols.get_column (name);
+      ASSERT_EQ (vertexcols.size (), column.size ());
+      ASSERT_THROW (column.has_value (column.size ()), out_of_range);
+      size_t count = 0;
+      for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++) {
+	map<string, string> attrs = parser.get_vertex_attributes (string (parser.get_vertex_name (id)));
+	equalElement (column, id, attrs, name);
+	count += attrs.count (name);
+      }
+      ASSERT_EQ (count, column.count ());
+    }
+
+    // and edges by their index in the CSR format
+    dot::csr graph = parser.get_csr ();
+    dot::columns edgecols = parser.get_edge_columns ();
+    ASSERT_EQ (graph.get_nb_edges (), edgecols.size ());
+    set<string> names;
+    for (uint32_t edge = 0 ; edge < graph.get_nb_edges () ; edge++)
+      for (auto& attr : graph.get_edge_attributes (edge))
+	names.insert (attr.first);
+    ASSERT_EQ (vector<string> (names.begin (), names.end ()), edgecols.get_names ());
+    for (auto& name : names) {
+      const dot::column& column = edgecols.get_column (name);
+      for (uint32_t edge = 0 ; edge < graph.get_nb_edges () ; edge++)
+	equalElement (column, edge, graph.get_edge_attributes (edge), name);
+    }
+  }
+}
+
+// Checks that numbers are traversed in contiguous memory
+// ----------------------------------------------------------------------------
+TEST (Columns, Numbers)
+{
+  string dotgraph = "digraph G {\n";
+  double expected = 0;
+  for (auto i = 0 ; i < 1000 ; i++) {
+    dotgraph += " v" + to_string (i) + " -> [weight=" + to_string (i) + ".5] v" + to_string (i+1) + ";\n";
+    expected += i + 0.5;
+  }
+  dotgraph += " v0 -> [color=red] v2;\n}\n";
+  dot::parser parser;
+  parser.parse_string (dotgraph);
+  dot::columns edges = parser.get_edge_columns ();
+  ASSERT_EQ (1001, edges.size ());
+
+  // the edge with no weight is not a number, and it is skipped
+  const dot::column& weights = edges.get_column ("weight");
+  double sum = 0;
+  for (auto weight : weights.get_numbers ())
+    if (!isnan (weight))
+      sum += weight;
+  EXPECT_EQ (expected, sum);
+  EXPECT_EQ (1000, weights.count ());
+  EXPECT_FALSE (weights.has_value (1));
+  EXPECT_EQ ("red", edges.get_column ("color").get_text (1));
+  EXPECT_FALSE (edges.get_column ("color").is_number (1));
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
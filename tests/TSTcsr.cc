@@ -0,0 +1,80 @@
+/*
+  TSTcsr.cc
+  Description: DOTcsr unit test cases
+  Started on  <Fri Oct 16 20:31:05 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that graphs with no vertices are correctly represented
+// ----------------------------------------------------------------------------
+TEST (CSR, Empty)
+{
+  dot::parser parser;
+  parser.parse_string ("graph G {\n}\n");
+  dot::csr graph = parser.get_csr ();
+  EXPECT_EQ (0, graph.get_nb_vertices ());
+  EXPECT_EQ (0, graph.get_nb_edges ());
+  EXPECT_EQ (vector<uint32_t> {0}, graph.get_offsets ());
+}
+
+// Checks that the neighbours and edge attributes of every vertex of random
+// graphs are the same in the CSR format and in the parser
+// ----------------------------------------------------------------------------
+TEST (CSR, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::parser parser;
+    parser.parse_string (dotgraph);
+    dot::csr graph = parser.get_csr ();
+
+    ASSERT_EQ (parser.get_nb_vertices (), graph.get_nb_vertices ());
+    ASSERT_EQ (graph.get_nb_edges (), graph.get_offsets ().back ());
+    ASSERT_EQ (graph.get_nb_edges (), graph.get_attribute_ids ().size ());
+    for (uint32_t id = 0 ; id < graph.get_nb_vertices () ; id++) {
+
+      // neighbours are stored contiguously and in the same order
+      vector<uint32_t> neighbours (parser.get_neighbour_ids (id).begin (),
+				   parser.get_neighbour_ids (id).end ());
+      ASSERT_EQ (neighbours.size (), graph.get_degree (id));
+      vector<uint32_t> targets (graph.get_targets ().begin () + graph.get_offsets ()[id],
+				graph.get_targets ().begin () + graph.get_offsets ()[id+1]);
+      ASSERT_EQ (neighbours, targets) << dotgraph << endl;
+
+      // and so are the attributes of every edge
+      for (uint32_t edge = graph.get_offsets ()[id] ; edge < graph.get_offsets ()[id+1] ; edge++)
+	ASSERT_EQ (parser.get_edge_attributes (string (parser.get_vertex_name (id)),
+					       string (parser.get_vertex_name (graph.get_targets ()[edge]))),
+		   graph.get_edge_attributes (edge)) << dotgraph << endl;
+    }
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,187 @@
+/*
+  TSTgenerator.cc
+  Description: DOTgenerator unit test cases
+  Started on  <Sat Oct 17 19:10:44 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return the graph generated by the given generator as a string
+string generate (dot::generator& generator)
+{
+  stringstream stream;
+  uint64_t nbbytes = generator.generate (stream);
+  string contents = stream.str ();
+  EXPECT_EQ (contents.size (), nbbytes);
+  return contents;
+}
+
+// Checks that random graphs are generated with precisely the number of
+// vertices requested and at most the number of edges requested, and that they
+// are parsed
+// ----------------------------------------------------------------------------
+TEST (Generator, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    uint64_t nbvertices = 1 + rand () % 200;
+    uint64_t nbedges = rand () % 1000;
+    dot::generator generator {nbvertices, nbedges, uint64_t (rand ())};
+    generator.set_directed (rand () % 2);
+    generator.set_exponent ((rand () % 30) / 10.0);
+    generator.set_vertex_attributes (rand () % 5, (rand () % 11) / 10.0);
+    generator.set_edge_attributes (rand () % 5, (rand () % 11) / 10.0);
+    generator.set_comments ((rand () % 11) / 10.0);
+    generator.set_statements ((rand () % 11) / 10.0, 1 + rand () % 10, 1 + rand () % 10);
+    string contents = generate (generator);
+
+    dot::parser parser;
+    ASSERT_TRUE (parser.parse_string (contents)) << contents << endl;
+    ASSERT_EQ (generator.get_directed () ? "digraph" : "graph", parser.get_type ());
+    ASSERT_EQ (nbvertices, parser.get_nb_vertices ());
+    for (uint32_t id = 0 ; id < nbvertices ; id++)
+      ASSERT_EQ ("v" + to_string (id), parser.get_vertex_name (id));
+
+    // undirected edges are stored in both directions, and duplicated edges
+    // are stored only once
+    size_t nbneighbours = 0;
+    for (uint32_t id = 0 ; id < nbvertices ; id++)
+      nbneighbours += parser.get_neighbour_ids (id).size ();
+    ASSERT_LE (nbneighbours, generator.get_directed () ? nbedges : 2 * nbedges);
+    ASSERT_EQ (nbedges > 0, nbneighbours > 0);
+  }
+}
+
+// Checks that the same graph is generated for the same seed, and a different
+// one otherwise
+// ----------------------------------------------------------------------------
+TEST (Generator, Seed)
+{
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    dot::generator generator1 {100, 1000, uint64_t (i)}, generator2 {100, 1000, uint64_t (i)};
+    dot::generator generator3 {100, 1000, uint64_t (i + 1)};
+    for (auto generator : {&generator1, &generator2, &generator3}) {
+      generator->set_vertex_attributes (3, 0.5);
+      generator->set_edge_attributes (3, 0.5);
+      generator->set_comments (0.1);
+      generator->set_statements (0.2, 5, 5);
+    }
+    string contents = generate (generator1);
+    ASSERT_EQ (contents, generate (generator1));
+    ASSERT_EQ (contents, generate (generator2));
+    ASSERT_NE (contents, generate (generator3));
+  }
+
+  // the output of a fixed seed does not change between platforms when
+  // vertices are uniformly chosen
+  dot::generator generator {3, 3, 1};
+  EXPECT_EQ ("digraph G {\n\tv0;\n\tv1;\n\tv2;\n\tv0 -> v0;\n\tv1 -> v2;\n\tv1 -> v2;\n}\n",
+	     generate (generator));
+}
+
+// Checks that vertices with the lowest identifiers become hubs when degrees
+// follow a power-law distribution, and that they do not otherwise
+// ----------------------------------------------------------------------------
+TEST (Generator, PowerLaw)
+{
+  for (auto exponent : {0.0, 1.0, 1.5}) {
+    dot::generator generator {10000, 100000, 7};
+    generator.set_exponent (exponent);
+    dot::parser parser;
+    parser.parse_string (generate (generator));
+
+    vector<size_t> degrees;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      degrees.push_back (parser.get_neighbour_ids (id).size ());
+    size_t hub = degrees[0];
+    sort (degrees.begin (), degrees.end ());
+    size_t median = degrees[degrees.size () / 2];
+    if (exponent == 0.0)
+      EXPECT_LT (hub, 10 * (median + 1));
+    else
+      EXPECT_GT (hub, 100 * (median + 1));
+  }
+}
+
+// Checks that comments, attributes and blocks are written with the given
+// densities
+// ----------------------------------------------------------------------------
+TEST (Generator, Densities)
+{
+  dot::generator generator {1000, 10000, 3};
+  string contents = generate (generator);
+  EXPECT_EQ (string::npos, contents.find ("//"));
+  EXPECT_EQ (string::npos, contents.find ("["));
+  EXPECT_EQ (string::npos, contents.find ("{ "));
+
+  generator.set_vertex_attributes (2, 1.0);
+  generator.set_edge_attributes (1, 1.0);
+  generator.set_comments (1.0);
+  generator.set_statements (1.0, 4, 1);
+  contents = generate (generator);
+  dot::parser parser;
+  parser.parse_string (contents);
+  EXPECT_EQ (1000, parser.get_all_vertex_attributes ().size ());
+  for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++) {
+    EXPECT_EQ (2, parser.get_vertex_attribute_map (id).size ());
+    for (auto neighbour : parser.get_neighbour_ids (id))
+      EXPECT_EQ (1, parser.get_edge_attribute_map (id, neighbour).size ());
+  }
+
+  // every statement is preceded by a comment, and all edges are in blocks
+  size_t nbcomments = 0, nbstatements = 0, nbblocks = 0;
+  for (size_t i = 0 ; i + 1 < contents.size () ; i++) {
+    nbcomments += contents[i] == '/' && contents[i + 1] == '/';
+    nbstatements += contents[i] == ';';
+    nbblocks += contents[i] == '{' && contents[i + 1] == ' ';
+  }
+  EXPECT_EQ (nbstatements, nbcomments);
+  EXPECT_EQ (nbstatements, 1000 + nbblocks);
+}
+
+// Checks that invalid arguments are rejected and that graphs are also written
+// into files
+// ----------------------------------------------------------------------------
+TEST (Generator, Errors)
+{
+  EXPECT_THROW (dot::generator (0, 1), invalid_argument);
+  dot::generator generator {10, 10};
+  EXPECT_THROW (generator.set_exponent (-1), invalid_argument);
+  EXPECT_THROW (generator.set_vertex_attributes (-1, 0.5), invalid_argument);
+  EXPECT_THROW (generator.set_vertex_attributes (1, 1.5), invalid_argument);
+  EXPECT_THROW (generator.set_edge_attributes (1, -0.5), invalid_argument);
+  EXPECT_THROW (generator.set_comments (2), invalid_argument);
+  EXPECT_THROW (generator.set_statements (0.5, 0, 1), invalid_argument);
+  EXPECT_THROW (generator.set_statements (0.5, 1, 0), invalid_argument);
+  EXPECT_THROW (generator.generate ("/this/directory/does/not/exist/graph.dot"), invalid_argument);
+
+  string filename = writeTemporaryFile ("");
+  ASSERT_NE ("", filename);
+  EXPECT_EQ (generate (generator).size (), generator.generate (filename));
+  dot::parser parser {filename};
+  parser.parse ();
+  EXPECT_EQ (10, parser.get_nb_vertices ());
+  remove (filename.c_str ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -7,11 +7,32 @@
   Login   <carlos.linares@uc3m.es>
 */
 
+#include <fstream>
 #include <vector>
 
+#include <unistd.h>
+
 #include "TSTdefs.h"
 #include "TSThelperfunctions.h"
 
+// ----------------------------------------------------------------------------
+// TESTS
+// ----------------------------------------------------------------------------
+
+// return a copy of the given views as strings
+map<string, string> toStrings (const map<string_view, string_view>& views)
+{
+  map<string, string> strings;
+  for (auto& view : views)
+    strings[string (view.first)] = view.second;
+  return strings;
+}
+
+vector<string> toStrings (const vector<string_view>& views)
+{
+  return vector<string> (views.begin (), views.end ());
+}
+
 // ----------------------------------------------------------------------------
 // INTEGERS
 // ----------------------------------------------------------------------------
@@ -144,6 +165,23 @@ string randQuotedString (int length, std::string exclude)
   return randstr;
 }
 
+// Generate a random string of the given length with characters which are
+// meaningful in the DOT language, i.e., blanks, digits, signs, letters,
+// brackets, quotes, separators, and so on
+string randDotString (int length)
+{
+
+  // characters are randomly sampled from the following collection which
+  // contains (at least) one character of every class used in the DOT language
+  const string alphabet = " \t\n\r\v\f-+.eE0129aZ_x\"[],;={}/>";
+  
+  std::string randstr = "";
+  for (int i = 0 ; i < length ; i++)
+    randstr += alphabet[rand () % alphabet.size ()];
+
+  return randstr;
+}
+
 // ----------------------------------------------------------------------------
 // GRAPHS
 // ----------------------------------------------------------------------------
@@ -794,6 +832,24 @@ string randGraph (int nbnodestmts, int p, int nbmultiplenodes, int nbedges, int
   return output;
 }
 
+// ----------------------------------------------------------------------------
+// FILES
+// ----------------------------------------------------------------------------
+
+// write the given contents into a new temporary file and return its name. If
+// the file could not be created, the empty string is returned
+string writeTemporaryFile (const string& contents)
+{
+  char name[] = "/tmp/libdot-XXXXXX";
+  int fd = mkstemp (name);
+  if (fd < 0)
+    return "";
+  close (fd);
+  ofstream stream (name, ios::binary);
+  stream << contents;
+  return name;
+}
+
 
 /* Local Variables: */
 /* mode:c++ */
@@ -16,6 +16,7 @@
 #include <iostream> 
 #include <map>
 #include <set>
+#include <string_view>
 #include <vector>
 
 using namespace std; 
@@ -67,6 +68,10 @@ bool equalMaps (map<T, vector<T>>& m1, map<T, vector<T>>& m2)
   return true;
 }
 
+// return a copy of the given views as strings
+map<string, string> toStrings (const map<string_view, string_view>& views);
+vector<string> toStrings (const vector<string_view>& views);
+
 // ----------------------------------------------------------------------------
 // INTEGERS
 // ----------------------------------------------------------------------------
@@ -112,6 +117,11 @@ string randString (int length, std::string exclude=":;<=>?@[\\]^`");
 // exclude avoids the quoted string to be prematurely ended
 string randQuotedString (int length, std::string exclude="\"");
 
+// Generate a random string of the given length with characters which are
+// meaningful in the DOT language, i.e., blanks, digits, signs, letters,
+// brackets, quotes, separators, and so on
+string randDotString (int length);
+
 // ----------------------------------------------------------------------------
 // GRAPHS
 // ----------------------------------------------------------------------------
@@ -280,6 +290,14 @@ string randGraph (int nbnodestmts, int p, int nbmultiplenodes, int nbedges, int
 		  map<string, map<string, string>>& vertexattrs,
 		  map<string, map<string, map<string, string>>>& edgeattrs);
 
+// ----------------------------------------------------------------------------
+// FILES
+// ----------------------------------------------------------------------------
+
+// write the given contents into a new temporary file and return its name. If
+// the file could not be created, the empty string is returned
+string writeTemporaryFile (const string& contents);
+
 #endif 	    /* !TSTHELPERFUNCTIONS_H_ */
 
 
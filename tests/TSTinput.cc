@@ -0,0 +1,139 @@
+/*
+  TSTinput.cc
+  Description: DOTinput unit test cases
+  Started on  <Fri Oct 16 14:40:08 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that the contents of regular files are mapped into memory
+// ----------------------------------------------------------------------------
+TEST (Input, RegularFile)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    string contents = randDotString (1 + rand () % 10000);
+    string filename = writeTemporaryFile (contents);
+
+    dot::input input;
+    ASSERT_TRUE (input.open (filename));
+    EXPECT_TRUE (input.is_mapped ());
+    EXPECT_EQ (contents, input.get_contents ());
+    remove (filename.c_str ());
+  }
+}
+
+// Checks that empty files have no contents
+// ----------------------------------------------------------------------------
+TEST (Input, EmptyFile)
+{
+  string filename = writeTemporaryFile ("");
+
+  dot::input input;
+  ASSERT_TRUE (input.open (filename));
+  EXPECT_EQ ("", input.get_contents ());
+  remove (filename.c_str ());
+}
+
+// Checks that the contents of pipes are read into a buffer
+// ----------------------------------------------------------------------------
+TEST (Input, Pipe)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    // write random contents into a pipe. They are short enough to fit in the
+    // pipe so that the writer never blocks
+    string contents = randDotString (rand () % 4096);
+    int fds[2];
+    ASSERT_EQ (0, pipe (fds));
+    ASSERT_EQ (ssize_t (contents.size ()), write (fds[1], contents.data (), contents.size ()));
+    close (fds[1]);
+
+    // and read them through the file system
+    dot::input input;
+    ASSERT_TRUE (input.open ("/proc/self/fd/" + to_string (fds[0])));
+    EXPECT_FALSE (input.is_mapped ());
+    EXPECT_EQ (contents, input.get_contents ());
+    close (fds[0]);
+  }
+}
+
+// Checks that files which do not exist can not be opened
+// ----------------------------------------------------------------------------
+TEST (Input, FileNotFound)
+{
+  dot::input input;
+  EXPECT_FALSE (input.open ("/this/file/does/not/exist.dot"));
+  EXPECT_EQ ("", input.get_contents ());
+}
+
+// Checks that inputs can be moved
+// ----------------------------------------------------------------------------
+TEST (Input, Move)
+{
+  srand (time (nullptr));
+
+  string contents = randDotString (1 + rand () % 10000);
+  string filename = writeTemporaryFile (contents);
+
+  dot::input input;
+  ASSERT_TRUE (input.open (filename));
+  dot::input other (std::move (input));
+  EXPECT_EQ ("", input.get_contents ());
+  EXPECT_EQ (contents, other.get_contents ());
+  input = std::move (other);
+  EXPECT_EQ (contents, input.get_contents ());
+  remove (filename.c_str ());
+}
+
+// Checks that graphs are parsed from mapped files
+// ----------------------------------------------------------------------------
+TEST (Input, ParseMappedFile)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string contents = randGraph (10, 5, 3, 20, 2, 3, 2, 2, "graph",
+				 DIRECTED_GRAPH, DIRECTED_EDGE,
+				 vertices, edges, labels, vertexattrs, edgeattrs);
+    string filename = writeTemporaryFile (contents);
+
+    dot::parser fromfile (filename);
+    dot::parser fromstring;
+    ASSERT_TRUE (fromfile.parse ());
+    ASSERT_TRUE (fromstring.parse_string (contents));
+    EXPECT_EQ (fromstring.get_graph (), fromfile.get_graph ());
+    EXPECT_EQ (fromstring.get_all_vertex_attributes (), fromfile.get_all_vertex_attributes ());
+    EXPECT_EQ (fromstring.get_all_edge_attributes (), fromfile.get_all_edge_attributes ());
+    remove (filename.c_str ());
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
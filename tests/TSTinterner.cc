@@ -0,0 +1,88 @@
+/*
+  TSTinterner.cc
+  Description: DOTinterner unit test cases
+  Started on  <Fri Oct 16 19:48:21 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that names are given dense identifiers in the same order they are
+// interned
+// ----------------------------------------------------------------------------
+TEST (Interner, Intern)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    // intern random names, some of them repeated
+    dot::interner interner;
+    map<string, uint32_t> expected;
+    for (auto j = 0 ; j < 1000 ; j++) {
+      string name = randString (1 + rand () % 3);
+      uint32_t id = interner.intern (name);
+      if (expected.find (name) == expected.end ()) {
+	ASSERT_EQ (expected.size (), id);
+	expected[name] = id;
+      }
+      ASSERT_EQ (expected[name], id);
+    }
+
+    // and verify the translation in both directions
+    ASSERT_EQ (expected.size (), interner.size ());
+    for (auto& name : expected) {
+      ASSERT_EQ (name.second, interner.find (name.first));
+      ASSERT_EQ (name.first, interner.get_name (name.second));
+    }
+  }
+}
+
+// Checks that names which were never interned are not found
+// ----------------------------------------------------------------------------
+TEST (Interner, NotFound)
+{
+  dot::interner interner;
+  interner.intern ("a");
+  EXPECT_EQ (dot::interner::npos, interner.find ("b"));
+  EXPECT_THROW (interner.get_name (1), out_of_range);
+}
+
+// Checks that interners can be copied and moved
+// ----------------------------------------------------------------------------
+TEST (Interner, CopyMove)
+{
+  srand (time (nullptr));
+
+  dot::interner interner;
+  for (auto j = 0 ; j < 1000 ; j++)
+    interner.intern (randString (1 + rand () % 20));
+
+  dot::interner copy {interner};
+  dot::interner moved {std::move (interner)};
+  interner = copy;
+  ASSERT_EQ (copy.size (), moved.size ());
+  ASSERT_EQ (copy.size (), interner.size ());
+  for (uint32_t id = 0 ; id < copy.size () ; id++) {
+    ASSERT_EQ (id, copy.find (moved.get_name (id)));
+    ASSERT_EQ (id, moved.find (copy.get_name (id)));
+    ASSERT_EQ (id, interner.find (copy.get_name (id)));
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,132 @@
+/*
+  TSTlexer.cc
+  Description: DOTlexer unit test cases
+  Started on  <Fri Oct 16 10:02:17 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <regex>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Verify that the matcher of the token T recognizes precisely the same prefix
+// of random strings than the given regexp and that it returns the same value
+// than the group of the regexp given in group (if any)
+template<dot::token T>
+void equalMatches (const string& regexp, int group)
+{
+  regex pattern {regexp};
+  for (auto i = 0 ; i < 1000*NB_TESTS ; i++) {
+
+    // create a random string with characters which are meaningful in the DOT
+    // language
+    const string text = randDotString (rand () % 16);
+
+    // match it with both the regexp and the lexer
+    cmatch matches;
+    bool found = regex_search (text.data (), text.data () + text.size (),
+			       matches, pattern, regex_constants::match_continuous);
+    string_view value;
+    size_t length = dot::lexer::match<T> (text, value);
+
+    // and verify the results are the same
+    ASSERT_EQ (found, length != dot::lexer::npos) << "[" << text << "]" << endl;
+    if (found) {
+      ASSERT_EQ (size_t (matches.length ()), length) << "[" << text << "]" << endl;
+      if (group)
+	ASSERT_EQ (string (matches[group]), string (value)) << "[" << text << "]" << endl;
+    }
+  }
+}
+
+// return the length of the match of the token T at the beginning of text. It
+// is used to verify that tokens can be recognized at compile time
+template<dot::token T>
+constexpr size_t matchLength (string_view text)
+{
+  string_view value;
+  return dot::lexer::match<T> (text, value);
+}
+
+// Checks that the tokens of the specification part of a graph are recognized
+// as the regexps in DOTdefs.h do
+// ----------------------------------------------------------------------------
+TEST (Lexer, Specification)
+{
+  srand (time (nullptr));
+
+  equalMatches<dot::token::graph_type> (GRAPH_TYPE, 1);
+  equalMatches<dot::token::graph_name> (GRAPH_NAME, 1);
+  equalMatches<dot::token::block_begin> (BLOCK_BEGIN, 0);
+  equalMatches<dot::token::block_end> (BLOCK_END, 0);
+  equalMatches<dot::token::end_of_statement> (END_OF_STATEMENT, 0);
+  equalMatches<dot::token::cpp_comment> (CPP_COMMENT, 0);
+}
+
+// Checks that the tokens of labels are recognized as the regexps in DOTdefs.h
+// do
+// ----------------------------------------------------------------------------
+TEST (Lexer, Labels)
+{
+  srand (time (nullptr));
+
+  equalMatches<dot::token::label_assignment> (LABEL_ASSIGNMENT, 1);
+  equalMatches<dot::token::label_value> (LABEL_VALUE, 1);
+}
+
+// Checks that the tokens of edges are recognized as the regexps in DOTdefs.h
+// do
+// ----------------------------------------------------------------------------
+TEST (Lexer, Edges)
+{
+  srand (time (nullptr));
+
+  equalMatches<dot::token::vertex_name> (VERTEX_NAME, 1);
+  equalMatches<dot::token::edge_type> (EDGE_TYPE, 1);
+}
+
+// Checks that the tokens of attributes are recognized as the regexps in
+// DOTdefs.h do
+// ----------------------------------------------------------------------------
+TEST (Lexer, Attributes)
+{
+  srand (time (nullptr));
+
+  equalMatches<dot::token::attribute_begin> (ATTRIBUTE_BEGIN, 0);
+  equalMatches<dot::token::attribute_name> (ATTRIBUTE_NAME, 1);
+  equalMatches<dot::token::attribute_value_next> (ATTRIBUTE_VALUE_NEXT, 1);
+  equalMatches<dot::token::attribute_value_end> (ATTRIBUTE_VALUE_END, 1);
+  equalMatches<dot::token::attribute_end> (ATTRIBUTE_END, 0);
+}
+
+// Checks that tokens, and values which need no double quotes, are recognized
+// at compile time
+// ----------------------------------------------------------------------------
+TEST (Lexer, CompileTime)
+{
+  static_assert (matchLength<dot::token::graph_type> ("\n digraph G {") == 9);
+  static_assert (matchLength<dot::token::edge_type> ("\t-> b") == 3);
+  static_assert (matchLength<dot::token::label_value> (" \"a\" \"b\" ;") == 9);
+  static_assert (matchLength<dot::token::attribute_value_end> (" -1.5e-12 ]") == 11);
+  static_assert (matchLength<dot::token::attribute_value_end> (" \"a\"\"b\"]") == 8);
+  static_assert (matchLength<dot::token::attribute_value_end> (" 1.5a ]") == dot::lexer::npos);
+  static_assert (dot::lexer::is_attribute_value ("-1.5e-12") && dot::lexer::is_attribute_value ("1a"));
+  static_assert (!dot::lexer::is_attribute_value ("") && !dot::lexer::is_attribute_value ("a b"));
+  static_assert (dot::lexer::is_label_value ("ab") && !dot::lexer::is_label_value ("a"));
+  static_assert (!dot::lexer::is_label_value ("1a") && !dot::lexer::is_label_value ("-"));
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
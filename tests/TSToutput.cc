@@ -0,0 +1,85 @@
+/*
+  TSToutput.cc
+  Description: DOToutput unit test cases
+  Started on  <Sun Oct 18 00:41:56 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that random texts, characters and numbers are written in the same
+// order they are given, even if they are larger than the buffer
+// ----------------------------------------------------------------------------
+TEST (Output, Random)
+{
+  srand (time (nullptr));
+
+  dot::output output;
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    stringstream stream;
+    string expected;
+    output.open (stream);
+    while (expected.size () < 3 << 20) {
+      switch (rand () % 4) {
+      case 0: {
+	string text = randString (1 + rand () % 100);
+	output.put (text);
+	expected += text;
+	break;
+      }
+      case 1: {
+	string text (1 + rand () % (2 << 20), 'x');
+	output.put (text);
+	expected += text;
+	break;
+      }
+      case 2:
+	output.put ('c');
+	expected += 'c';
+	break;
+      default: {
+	uint64_t number = (uint64_t (rand ()) << 32) | rand ();
+	output.put (number);
+	expected += to_string (number);
+      }
+      }
+    }
+    ASSERT_EQ (expected.size (), output.close ());
+    ASSERT_EQ (expected, stream.str ());
+  }
+}
+
+// Checks that the bytes written are counted from the last time the output was
+// opened
+// ----------------------------------------------------------------------------
+TEST (Output, Reopen)
+{
+  dot::output output;
+  stringstream first, second;
+  output.open (first);
+  output.put ("digraph G {}\n");
+  EXPECT_EQ (13, output.close ());
+
+  output.open (second);
+  output.put (uint64_t (18446744073709551615ull));
+  EXPECT_EQ (20, output.close ());
+  EXPECT_EQ ("digraph G {}\n", first.str ());
+  EXPECT_EQ ("18446744073709551615", second.str ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
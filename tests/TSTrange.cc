@@ -0,0 +1,76 @@
+/*
+  TSTrange.cc
+  Description: DOTrange unit test cases
+  Started on  <Sat Oct 17 17:21:09 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that ranges with no elements are empty
+// ----------------------------------------------------------------------------
+TEST (Range, Empty)
+{
+  dot::range<const int*> empty;
+  EXPECT_TRUE (empty.empty ());
+  EXPECT_EQ (0, empty.size ());
+  EXPECT_EQ (empty.begin (), empty.end ());
+  EXPECT_THROW (empty.at (0), out_of_range);
+}
+
+// Checks that ranges over random contiguous elements give access to precisely
+// the same elements without copying them
+// ----------------------------------------------------------------------------
+TEST (Range, Contiguous)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    vector<int> elements (rand () % 100);
+    for (auto& element : elements)
+      element = rand ();
+
+    dot::range<const int*> range {elements.data (), elements.data () + elements.size ()};
+    ASSERT_EQ (elements.size (), range.size ());
+    ASSERT_EQ (elements.empty (), range.empty ());
+    ASSERT_EQ (elements, vector<int> (range.begin (), range.end ()));
+    for (size_t j = 0 ; j < elements.size () ; j++) {
+      ASSERT_EQ (&elements[j], &range[j]);
+      ASSERT_EQ (elements[j], range.at (j));
+    }
+    ASSERT_THROW (range.at (elements.size ()), out_of_range);
+  }
+}
+
+// Checks that ranges can be also given by iterators which are not pointers
+// ----------------------------------------------------------------------------
+TEST (Range, Iterators)
+{
+  list<string> elements {"a", "b", "c"};
+  dot::range<list<string>::const_iterator> range {elements.begin (), elements.end ()};
+  EXPECT_EQ (3, range.size ());
+  EXPECT_EQ ("b", range[1]);
+  EXPECT_EQ ("c", range.at (2));
+  string concatenation;
+  for (auto& element : range)
+    concatenation += element;
+  EXPECT_EQ ("abc", concatenation);
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
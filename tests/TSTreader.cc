@@ -0,0 +1,214 @@
+/*
+  TSTreader.cc
+  Description: DOTreader unit test cases
+  Started on  <Fri Oct 16 17:10:33 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// handler which records every notification as a line of text
+struct recorder : public dot::handler {
+
+  vector<string> events;
+
+  static string toString (const dot::attributes& attrs)
+  {
+    string text;
+    for (auto& attr : attrs)
+      text += " " + string (attr.first) + "=" + string (attr.second);
+    return text;
+  }
+
+  void graph (string_view type, string_view name)
+  { events.push_back ("graph " + string (type) + " " + string (name)); }
+  void label (string_view name, string_view value)
+  { events.push_back ("label " + string (name) + " " + string (value)); }
+  void vertex (string_view name)
+  { events.push_back ("vertex " + string (name)); }
+  void vertex_attributes (string_view name, const dot::attributes& attrs)
+  { events.push_back ("vertex_attributes " + string (name) + toString (attrs)); }
+  void edge (string_view orig, string_view target, bool directed)
+  { events.push_back ("edge " + string (orig) + (directed ? " -> " : " -- ") + string (target)); }
+  void edge_attributes (string_view orig, string_view target, bool directed,
+			const dot::attributes& attrs)
+  {
+    events.push_back ("edge_attributes " + string (orig) + (directed ? " -> " : " -- ") +
+		      string (target) + toString (attrs));
+  }
+};
+
+// handler which only records the edges, as pairs (origin, target)
+struct edge_collector : public dot::handler {
+
+  set<pair<string, string>> edges;
+
+  void edge (string_view orig, string_view target, bool directed)
+  {
+    edges.insert ({string (orig), string (target)});
+    if (!directed)
+      edges.insert ({string (target), string (orig)});
+  }
+};
+
+// Checks that all statements are notified in the same order they are given
+// ----------------------------------------------------------------------------
+TEST (Reader, Events)
+{
+  string dotgraph = "digraph G {\n"
+    "  rankdir = \"LR\";\n"
+    "  a [color=red, shape=\"box\"];\n"
+    "  a -> [w=1] b [color=blue] -- c;\n"
+    "  c -> { d e [k=2] }\n"
+    "}\n";
+  vector<string> expected {
+    "graph digraph G",
+    "label rankdir LR",
+    "vertex_attributes a color=red shape=box",
+    "vertex a",
+    "edge a -> b",
+    "edge_attributes a -> b w=1",
+    "vertex_attributes b color=blue",
+    "edge b -- c",
+    "edge c -> d",
+    "edge c -> e",
+    "vertex_attributes e k=2"};
+
+  dot::reader reader;
+  recorder handler;
+  ASSERT_TRUE (reader.parse_string (dotgraph, handler));
+  EXPECT_EQ (expected, handler.events);
+}
+
+// Checks that statements fed in chunks are notified once and in the same order
+// than when given at once
+// ----------------------------------------------------------------------------
+TEST (Reader, FeedEvents)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::reader expected;
+    recorder expected_handler;
+    expected.parse_string (dotgraph, expected_handler);
+
+    dot::reader reader;
+    recorder handler;
+    for (size_t j = 0 ; j < dotgraph.size () ; ) {
+      size_t length = min (size_t (1 + rand () % 16), dotgraph.size () - j);
+      reader.feed (dotgraph.data () + j, length, handler);
+      j += length;
+    }
+    ASSERT_TRUE (reader.finish (handler));
+    ASSERT_EQ (expected_handler.events, handler.events) << dotgraph << endl;
+  }
+}
+
+// Checks that handlers can process only some notifications and that the edges
+// notified are precisely those stored by the parser
+// ----------------------------------------------------------------------------
+TEST (Reader, Edges)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::reader reader;
+    edge_collector handler;
+    ASSERT_TRUE (reader.parse_string (dotgraph, handler));
+
+    dot::parser parser;
+    parser.parse_string (dotgraph);
+    set<pair<string, string>> expected;
+    for (auto& vertex : parser.get_graph ())
+      for (auto& neighbour : vertex.second)
+	expected.insert ({vertex.first, neighbour});
+    ASSERT_EQ (expected, handler.edges) << dotgraph << endl;
+  }
+}
+
+// Checks that syntax errors are reported to handlers that ignore everything
+// ----------------------------------------------------------------------------
+TEST (Reader, SyntaxError)
+{
+  dot::reader reader;
+  dot::handler handler;
+  EXPECT_THROW (reader.parse_string ("digraph G {\n a -> ;\n}\n", handler), dot::syntax_error);
+}
+
+// Checks that recorded notifications are replayed in the same order they were
+// received
+// ----------------------------------------------------------------------------
+TEST (Reader, Replay)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::reader expected;
+    recorder expected_handler;
+    expected.parse_string (dotgraph, expected_handler);
+
+    // record all notifications and replay them
+    dot::reader reader;
+    dot::recorder notifications;
+    reader.parse_string (dotgraph, notifications);
+    ASSERT_EQ (expected_handler.events.size (), notifications.size ());
+    recorder handler;
+    notifications.replay (handler);
+    ASSERT_EQ (expected_handler.events, handler.events) << dotgraph << endl;
+
+    // and only the first ones once they are truncated
+    size_t n = rand () % (1 + notifications.size ());
+    notifications.truncate (n);
+    recorder truncated;
+    notifications.replay (truncated);
+    ASSERT_EQ (vector<string> (expected_handler.events.begin (), expected_handler.events.begin () + n),
+	       truncated.events) << dotgraph << endl;
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
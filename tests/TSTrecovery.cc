@@ -0,0 +1,208 @@
+/*
+  TSTrecovery.cc
+  Description: Unit test cases of the recovery from syntax errors
+  Started on  <Sat Oct 17 21:40:19 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return the syntax error raised when parsing the given contents with the
+// given number of threads, or fed in chunks if nbthreads is zero
+dot::syntax_error parseError (const string& dotgraph, unsigned int nbthreads)
+{
+  dot::parser parser;
+  try {
+    if (nbthreads) {
+      parser.parse_string (dotgraph, nbthreads);
+    } else {
+      for (size_t i = 0 ; i < dotgraph.size () ; i += 7)
+	parser.feed (dotgraph.data () + i, min (size_t (7), dotgraph.size () - i));
+      parser.finish ();
+    }
+  } catch (const dot::syntax_error& error) {
+    return error;
+  }
+  ADD_FAILURE () << "no syntax error was raised" << endl;
+  return dot::syntax_error ("");
+}
+
+// Checks that syntax errors are located in the contents, also when they are
+// parsed in parallel or fed in chunks
+// ----------------------------------------------------------------------------
+TEST (Recovery, Positions)
+{
+  string body;
+  for (auto i = 0 ; i < 1000 ; i++)
+    body += "  a" + to_string (i) + " -> b" + to_string (i) + ";\n";
+
+  dot::syntax_error error = parseError ("digraph G {\n  a -> b;\n  c -> ;\n}\n", 1);
+  EXPECT_EQ (29, error.get_offset ());
+  EXPECT_EQ (3, error.get_line ());
+  EXPECT_EQ (8, error.get_column ());
+
+  error = parseError ("digraph G\n  a;\n}\n", 1);
+  EXPECT_EQ (12, error.get_offset ());
+  EXPECT_EQ (2, error.get_line ());
+  EXPECT_EQ (3, error.get_column ());
+
+  for (string dotgraph : {"digraph G {\n" + body + " a -> ;\n" + body + "}\n",
+	"digraph G {\n" + body + " a -> b [w=1\n" + body + "}\n",
+	"digraph G {\n" + body,
+	"digraph G\n" + body}) {
+    dot::syntax_error expected = parseError (dotgraph, 1);
+    ASSERT_LT (0, expected.get_line ());
+    ASSERT_LE (expected.get_offset (), dotgraph.size ());
+    for (auto nbthreads : {0, 3}) {
+      error = parseError (dotgraph, nbthreads);
+      EXPECT_STREQ (expected.what (), error.what ());
+      EXPECT_EQ (expected.get_offset (), error.get_offset ());
+      EXPECT_EQ (expected.get_line (), error.get_line ());
+      EXPECT_EQ (expected.get_column (), error.get_column ());
+    }
+  }
+}
+
+// Checks that all syntax errors are recorded in recovery mode, and that all
+// the other statements are parsed
+// ----------------------------------------------------------------------------
+TEST (Recovery, AllErrors)
+{
+  string dotgraph = "digraph G {\n"
+    "  a -> b;\n"
+    "  c -> ;\n"
+    "  d [w=] -> e;\n"
+    "  f -> g; -> h; i -> j\n"
+    "  k -> { l m }\n"
+    "}\n";
+  dot::parser parser;
+  parser.set_recovery ();
+  EXPECT_FALSE (parser.parse_string (dotgraph));
+
+  const vector<dot::syntax_error>& errors = parser.get_errors ();
+  ASSERT_EQ (3, errors.size ());
+  vector<pair<size_t, size_t>> positions {{3, 8}, {4, 8}, {5, 11}};
+  string symbols = ";]-";
+  for (size_t i = 0 ; i < errors.size () ; i++) {
+    EXPECT_EQ (positions[i], make_pair (errors[i].get_line (), errors[i].get_column ()));
+    EXPECT_EQ (symbols[i], dotgraph[errors[i].get_offset ()]);
+  }
+
+  // the statements before the errors in the same line are kept
+  EXPECT_EQ (vector<string> ({"b"}), parser.get_neighbours ("a"));
+  EXPECT_EQ (vector<string> ({"g"}), parser.get_neighbours ("f"));
+  EXPECT_EQ (vector<string> ({"j"}), parser.get_neighbours ("i"));
+  EXPECT_EQ (vector<string> ({"l", "m"}), parser.get_neighbours ("k"));
+
+  // parsing again forgets the previous errors
+  dot::parser other;
+  other.set_recovery ();
+  EXPECT_TRUE (other.parse_string ("graph G {\n  a -- b;\n}\n"));
+  EXPECT_TRUE (other.get_errors ().empty ());
+}
+
+// Checks that the header and the end of the block are verified in recovery
+// mode
+// ----------------------------------------------------------------------------
+TEST (Recovery, Block)
+{
+  dot::parser parser;
+  parser.set_recovery ();
+  EXPECT_FALSE (parser.parse_string ("digraph G\n  a -> b;\n}\n"));
+  ASSERT_EQ (1, parser.get_errors ().size ());
+  EXPECT_EQ (2, parser.get_errors ()[0].get_line ());
+  EXPECT_EQ (0, parser.get_nb_vertices ());
+
+  dot::parser unclosed;
+  unclosed.set_recovery ();
+  EXPECT_FALSE (unclosed.parse_string ("digraph G {\n  a -> b;\n  c -> ;\n"));
+  ASSERT_EQ (2, unclosed.get_errors ().size ());
+  EXPECT_STREQ ("BLOCK END missing", unclosed.get_errors ()[1].what ());
+  EXPECT_EQ (4, unclosed.get_errors ()[1].get_line ());
+  EXPECT_EQ (1, unclosed.get_errors ()[1].get_column ());
+  EXPECT_EQ (vector<string> ({"b"}), unclosed.get_neighbours ("a"));
+}
+
+// Checks that random graphs with wrong statements are parsed precisely as
+// without them in recovery mode, and that every wrong statement is reported
+// once, also when they are fed in chunks
+// ----------------------------------------------------------------------------
+TEST (Recovery, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+    dot::parser expected;
+    ASSERT_TRUE (expected.parse_string (dotgraph));
+
+    // insert wrong statements in their own lines, right after other lines
+    // but the last one
+    string wrong;
+    vector<size_t> lines;
+    size_t line = 1;
+    for (size_t j = 0 ; j < dotgraph.size () ; j++) {
+      wrong += dotgraph[j];
+      if (dotgraph[j] == '\n') {
+	line++;
+	if (j + 3 < dotgraph.size () && !(rand () % 4)) {
+	  wrong += "  -> wrong;\n";
+	  lines.push_back (line++);
+	}
+      }
+    }
+
+    dot::parser parser;
+    parser.set_recovery ();
+    ASSERT_EQ (lines.empty (), parser.parse_string (wrong));
+    ASSERT_EQ (lines.size (), parser.get_errors ().size ());
+    for (size_t j = 0 ; j < lines.size () ; j++) {
+      EXPECT_EQ (lines[j], parser.get_errors ()[j].get_line ());
+      EXPECT_EQ (3, parser.get_errors ()[j].get_column ());
+    }
+    ASSERT_EQ (expected.get_nb_vertices (), parser.get_nb_vertices ());
+    for (uint32_t id = 0 ; id < expected.get_nb_vertices () ; id++) {
+      ASSERT_EQ (expected.get_vertex_name (id), parser.get_vertex_name (id));
+      ASSERT_EQ (expected.get_neighbour_ids (id), parser.get_neighbour_ids (id));
+    }
+
+    dot::parser fed;
+    fed.set_recovery ();
+    for (size_t j = 0 ; j < wrong.size () ; ) {
+      size_t length = min (size_t (1 + rand () % 16), wrong.size () - j);
+      fed.feed (wrong.data () + j, length);
+      j += length;
+    }
+    ASSERT_EQ (lines.empty (), fed.finish ());
+    ASSERT_EQ (lines.size (), fed.get_errors ().size ());
+    for (size_t j = 0 ; j < lines.size () ; j++) {
+      EXPECT_EQ (parser.get_errors ()[j].get_offset (), fed.get_errors ()[j].get_offset ());
+      EXPECT_EQ (lines[j], fed.get_errors ()[j].get_line ());
+    }
+    ASSERT_EQ (expected.get_nb_vertices (), fed.get_nb_vertices ());
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,116 @@
+/*
+  TSTscan.cc
+  Description: DOTscan unit test cases
+  Started on  <Fri Oct 16 12:31:50 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return a random text made of runs of blanks, identifiers and quoted strings
+// (without the double quotes) of up to 80 characters each, separated by random
+// characters which are meaningful in the DOT language
+string randRuns (int nbruns)
+{
+  string text;
+  for (auto i = 0 ; i < nbruns ; i++) {
+    switch (rand () % 3) {
+    case 0: /* blanks */
+      for (auto j = rand () % 80 ; j >= 0 ; j--)
+	text += " \t\n\r\v\f"[rand () % 6];
+      break;
+    case 1: /* identifiers */
+      text += randString (rand () % 80);
+      break;
+    case 2: /* quoted strings */
+      text += randQuotedString (rand () % 80);
+      break;
+    }
+    text += randDotString (1);
+  }
+  return text;
+}
+
+// Verify that the scan computed by the given service (which is one of the
+// static services of dot::scanner) with every instruction set supported by
+// this CPU is the same than the one computed with the scalar kernels
+void equalScans (const char* (*scan) (const char*, const char*))
+{
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    // create a random text and scan it from every position with the scalar
+    // kernels
+    string text = randRuns (20);
+    const char* end = text.data () + text.size ();
+    dot::scanner::set_isa (dot::scanner::isa::scalar);
+    vector<const char*> expected;
+    for (const char* p = text.data () ; p != end ; p++)
+      expected.push_back (scan (p, end));
+
+    // and now with every instruction set supported
+    for (auto level : {dot::scanner::isa::sse2, dot::scanner::isa::avx2}) {
+      if (level > dot::scanner::get_best_isa ())
+	continue;
+      dot::scanner::set_isa (level);
+      for (const char* p = text.data () ; p != end ; p++)
+	ASSERT_EQ (expected[p - text.data ()], scan (p, end))
+	  << dot::scanner::get_isa_name (level) << " [" << text << "] at " << p - text.data () << endl;
+    }
+  }
+
+  // restore the best kernels
+  dot::scanner::set_isa (dot::scanner::get_best_isa ());
+}
+
+// Checks that runs of blanks are equally scanned with all instruction sets
+// ----------------------------------------------------------------------------
+TEST (Scanner, Spaces)
+{
+  srand (time (nullptr));
+  equalScans (dot::scanner::spaces);
+}
+
+// Checks that identifiers are equally scanned with all instruction sets
+// ----------------------------------------------------------------------------
+TEST (Scanner, Identifier)
+{
+  srand (time (nullptr));
+  equalScans (dot::scanner::identifier);
+}
+
+// Checks that the contents of quoted strings are equally scanned with all
+// instruction sets
+// ----------------------------------------------------------------------------
+TEST (Scanner, Quote)
+{
+  srand (time (nullptr));
+  equalScans (dot::scanner::quote);
+}
+
+// Checks that unsupported instruction sets can not be selected
+// ----------------------------------------------------------------------------
+TEST (Scanner, UnsupportedISA)
+{
+  if (dot::scanner::get_best_isa () < dot::scanner::isa::avx2)
+    EXPECT_THROW (dot::scanner::set_isa (dot::scanner::isa::avx2), invalid_argument);
+
+  // the scalar kernels are always supported
+  EXPECT_NO_THROW (dot::scanner::set_isa (dot::scanner::isa::scalar));
+  dot::scanner::set_isa (dot::scanner::get_best_isa ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,207 @@
+/*
+  TSTsnapshot.cc
+  Description: DOTsnapshot unit test cases
+  Started on  <Sat Oct 17 13:22:37 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return a copy of the given attributes of all edges as strings
+map<string, map<string, map<string, string>>> toStrings (const map<string_view, map<string_view, map<string_view, string_view>>>& views)
+{
+  map<string, map<string, map<string, string>>> strings;
+  for (auto& origin : views)
+    for (auto& target : origin.second)
+      strings[string (origin.first)][string (target.first)] = toStrings (target.second);
+  return strings;
+}
+
+// Checks that snapshots of random graphs provide precisely the same contents
+// than the parsers they were written from
+// ----------------------------------------------------------------------------
+TEST (Snapshot, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::parser parser;
+    parser.parse_string (dotgraph);
+    string filename = writeTemporaryFile ("");
+    ASSERT_NE ("", filename);
+    dot::snapshot::save (parser, filename);
+    dot::snapshot snapshot {filename};
+    ASSERT_TRUE (snapshot.load ());
+
+    ASSERT_EQ (parser.get_type (), snapshot.get_type ());
+    ASSERT_EQ (parser.get_name (), snapshot.get_name ());
+    ASSERT_EQ (parser.get_labels (), toStrings (snapshot.get_labels ()));
+    for (auto& label : parser.get_labels ())
+      ASSERT_EQ (parser.get_label_value (label), snapshot.get_label_value (label));
+    ASSERT_EQ (parser.get_vertices (), toStrings (snapshot.get_vertices ()));
+    ASSERT_EQ (parser.get_nb_vertices (), snapshot.get_nb_vertices ());
+    ASSERT_EQ (parser.get_all_vertex_attributes ().size (), snapshot.get_all_vertex_attributes ().size ());
+    ASSERT_EQ (parser.get_all_edge_attributes (), toStrings (snapshot.get_all_edge_attributes ()));
+
+    // vertices are given the same identifiers, and their neighbours are
+    // given in the same order
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++) {
+      ASSERT_EQ (parser.get_vertex_name (id), snapshot.get_vertex_name (id));
+      ASSERT_EQ (id, snapshot.get_vertex_id (string (parser.get_vertex_name (id))));
+      ASSERT_EQ (vector<uint32_t> (parser.get_neighbour_ids (id).begin (), parser.get_neighbour_ids (id).end ()),
+		 snapshot.get_neighbour_ids (id));
+      ASSERT_EQ (snapshot.get_neighbour_ids (id),
+		 vector<uint32_t> (snapshot.get_neighbour_range (id).begin (), snapshot.get_neighbour_range (id).end ()));
+    }
+    dot::csr expected = parser.get_csr (), csr = snapshot.get_csr ();
+    ASSERT_EQ (expected.get_offsets (), csr.get_offsets ());
+    ASSERT_EQ (expected.get_targets (), csr.get_targets ());
+    for (size_t edge = 0 ; edge < expected.get_nb_edges () ; edge++)
+      ASSERT_EQ (expected.get_edge_attributes (edge), csr.get_edge_attributes (edge));
+
+    // check the neighbours and attributes of all vertices
+    for (auto& vertex : parser.get_vertices ()) {
+      ASSERT_EQ (parser.get_neighbours (vertex), toStrings (snapshot.get_neighbours (vertex)));
+      ASSERT_EQ (parser.get_vertex_attributes (vertex), toStrings (snapshot.get_vertex_attributes (vertex)));
+      for (auto& attr : parser.get_vertex_attributes (vertex))
+	ASSERT_EQ (attr.second, snapshot.get_vertex_attribute (vertex, attr.first));
+      for (auto& neighbour : parser.get_neighbours (vertex)) {
+	ASSERT_EQ (parser.get_edge_attributes (vertex, neighbour),
+		   toStrings (snapshot.get_edge_attributes (vertex, neighbour)));
+	for (auto& attr : parser.get_edge_attributes (vertex, neighbour))
+	  ASSERT_EQ (attr.second, snapshot.get_edge_attribute (vertex, neighbour, attr.first));
+      }
+    }
+
+    remove (filename.c_str ());
+  }
+}
+
+// Checks that snapshots raise the same exceptions than parsers when looking up
+// items that do not exist
+// ----------------------------------------------------------------------------
+TEST (Snapshot, NotFound)
+{
+  dot::parser parser;
+  parser.parse_string ("digraph G {\n label = \"graph\";\n a -> [w=1] b;\n b -> c;\n c [color=red];\n}\n");
+  string filename = writeTemporaryFile ("");
+  ASSERT_NE ("", filename);
+  dot::snapshot::save (parser, filename);
+  dot::snapshot snapshot {filename};
+  ASSERT_TRUE (snapshot.load ());
+
+  EXPECT_EQ ("graph", snapshot.get_label_value ("label"));
+  EXPECT_THROW (snapshot.get_label_value ("color"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_vertex_id ("d"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_vertex_name (3), out_of_range);
+  EXPECT_THROW (snapshot.get_neighbour_ids (3), out_of_range);
+  EXPECT_THROW (snapshot.get_neighbours ("d"), dot::syntax_error);
+  EXPECT_EQ ("red", snapshot.get_vertex_attribute ("c", "color"));
+  EXPECT_THROW (snapshot.get_vertex_attribute ("c", "shape"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_vertex_attribute ("d", "color"), dot::syntax_error);
+  EXPECT_EQ ("1", snapshot.get_edge_attribute ("a", "b", "w"));
+  EXPECT_THROW (snapshot.get_edge_attribute ("a", "b", "color"), dot::syntax_error);
+  EXPECT_EQ ("", snapshot.get_edge_attribute ("b", "c", "w"));
+  EXPECT_THROW (snapshot.get_edge_attributes ("a", "c"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_edge_attributes ("b", "a"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_edge_attributes ("a", "d"), dot::syntax_error);
+  EXPECT_THROW (snapshot.get_edge_attributes ("d", "a"), dot::syntax_error);
+
+  remove (filename.c_str ());
+}
+
+// Checks that files which are not valid snapshots are rejected
+// ----------------------------------------------------------------------------
+TEST (Snapshot, Errors)
+{
+  dot::snapshot missing {"/this/file/does/not/exist.snapshot"};
+  EXPECT_THROW (missing.load (), invalid_argument);
+
+  string dotfile = writeTemporaryFile ("digraph G {\n a -> b;\n}\n");
+  dot::snapshot notsnapshot {dotfile};
+  EXPECT_THROW (notsnapshot.load (), invalid_argument);
+  remove (dotfile.c_str ());
+
+  // write a valid snapshot and corrupt it in different ways
+  dot::parser parser;
+  parser.parse_string ("digraph G {\n a -> [w=1] b;\n}\n");
+  string filename = writeTemporaryFile ("");
+  ASSERT_NE ("", filename);
+  dot::snapshot::save (parser, filename);
+  string contents;
+  {
+    ifstream stream (filename, ios::binary);
+    contents.assign (istreambuf_iterator<char> (stream), istreambuf_iterator<char> ());
+  }
+  {
+    dot::snapshot snapshot {filename};
+    EXPECT_TRUE (snapshot.load ());
+  }
+
+  // a snapshot which is truncated
+  string truncated = writeTemporaryFile (contents.substr (0, contents.size () - 8));
+  dot::snapshot snapshot1 {truncated};
+  EXPECT_THROW (snapshot1.load (), invalid_argument);
+  remove (truncated.c_str ());
+
+  // and a snapshot with another version, which is stored right after the magic
+  // number
+  string other {contents};
+  other[8] = char (dot::snapshot::version + 1);
+  string version = writeTemporaryFile (other);
+  dot::snapshot snapshot2 {version};
+  EXPECT_THROW (snapshot2.load (), invalid_argument);
+  remove (version.c_str ());
+
+  // snapshots with any word overwritten are either rejected or restored as a
+  // graph with the same structure, i.e., only names and values can change
+  for (size_t i = 0 ; i + 4 <= contents.size () ; i += 4) {
+    string corrupted {contents};
+    corrupted.replace (i, 4, 4, char (0xff));
+    string overwritten = writeTemporaryFile (corrupted);
+    dot::snapshot snapshot3 {overwritten};
+    try {
+      snapshot3.load ();
+      dot::parser restored;
+      snapshot3.restore (restored);
+      EXPECT_EQ (2, restored.get_nb_vertices ()) << "word " << i / 4 << endl;
+      EXPECT_EQ (1, restored.get_neighbour_ids (0).size ()) << "word " << i / 4 << endl;
+      EXPECT_EQ (1, restored.get_neighbour_ids (0)[0]) << "word " << i / 4 << endl;
+      EXPECT_EQ (1, snapshot3.get_all_edge_attributes ().size ()) << "word " << i / 4 << endl;
+    } catch (const invalid_argument&) {}
+    remove (overwritten.c_str ());
+  }
+
+  // writing into a directory which does not exist raises an exception
+  EXPECT_THROW (dot::snapshot::save (parser, "/this/directory/does/not/exist/snapshot"), invalid_argument);
+
+  remove (filename.c_str ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
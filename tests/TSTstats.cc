@@ -0,0 +1,207 @@
+/*
+  TSTstats.cc
+  Description: DOTstats unit test cases
+  Started on  <Sat Oct 17 20:02:17 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return a random graph with labels, attributes, comments and blocks of
+// multiple vertices
+string randStatsGraph ()
+{
+  vector<string> vertices;
+  map<string, vector<string>> edges;
+  map<string, string> labels;
+  map<string, map<string, string>> vertexattrs;
+  map<string, map<string, map<string, string>>> edgeattrs;
+  return randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+		    DIRECTED_GRAPH, MIX_EDGE,
+		    vertices, edges, labels, vertexattrs, edgeattrs);
+}
+
+// Checks that the tokens of every kind are counted precisely
+// ----------------------------------------------------------------------------
+TEST (Stats, Tokens)
+{
+  ASSERT_TRUE (dot::stats::enabled);
+
+  string dotgraph = "digraph G {\n"
+    "  // a comment\n"
+    "  rankdir = \"LR\";\n"
+    "  a [color=red, shape=\"box\"];\n"
+    "  a -> [w=1] b -> { c d };\n"
+    "}\n";
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string (dotgraph));
+  dot::stats stats = parser.get_stats ();
+
+  EXPECT_EQ (1, stats.get_tokens (dot::token::graph_type));
+  EXPECT_EQ (1, stats.get_tokens (dot::token::graph_name));
+  EXPECT_EQ (2, stats.get_tokens (dot::token::block_begin));
+  EXPECT_EQ (2, stats.get_tokens (dot::token::block_end));
+  EXPECT_EQ (1, stats.get_tokens (dot::token::label_assignment));
+  EXPECT_EQ (1, stats.get_tokens (dot::token::label_value));
+  EXPECT_EQ (2, stats.get_tokens (dot::token::edge_type));
+  EXPECT_EQ (3, stats.get_tokens (dot::token::end_of_statement));
+  EXPECT_EQ (1, stats.get_tokens (dot::token::cpp_comment));
+  EXPECT_EQ (2, stats.get_tokens (dot::token::attribute_begin));
+  EXPECT_EQ (3, stats.get_tokens (dot::token::attribute_name));
+  EXPECT_EQ (1, stats.get_tokens (dot::token::attribute_value_next));
+  EXPECT_EQ (2, stats.get_tokens (dot::token::attribute_value_end));
+  EXPECT_EQ (0, stats.get_tokens (dot::token::attribute_end));
+
+  // and also the size of the contents and the graph
+  EXPECT_EQ (dotgraph.size (), stats.bytes);
+  EXPECT_EQ (3, stats.nb_statements);
+  EXPECT_EQ (4, stats.nb_vertices);
+  EXPECT_EQ (3, stats.nb_edges);
+  EXPECT_EQ (1, stats.nb_labels);
+  EXPECT_EQ (2, stats.peak_attributes);
+  EXPECT_EQ (2, stats.peak_degree);
+}
+
+// Checks that the statistics of random graphs are consistent with their
+// contents and the graph parsed
+// ----------------------------------------------------------------------------
+TEST (Stats, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    string dotgraph = randStatsGraph ();
+    dot::parser parser;
+    ASSERT_TRUE (parser.parse_string (dotgraph));
+    dot::stats stats = parser.get_stats ();
+
+    EXPECT_EQ (dotgraph.size (), stats.bytes);
+    EXPECT_EQ (parser.get_nb_vertices (), stats.nb_vertices);
+    EXPECT_EQ (parser.get_labels ().size (), stats.nb_labels);
+    size_t nbedges = 0;
+    for (uint32_t id = 0 ; id < parser.get_nb_vertices () ; id++)
+      nbedges += parser.get_neighbour_ids (id).size ();
+    EXPECT_EQ (nbedges, stats.nb_edges);
+
+    // every attribute section is closed either after its last value or right
+    // away if it is empty
+    EXPECT_EQ (1, stats.get_tokens (dot::token::graph_type));
+    EXPECT_EQ (stats.get_tokens (dot::token::attribute_begin),
+	       stats.get_tokens (dot::token::attribute_value_end) +
+	       stats.get_tokens (dot::token::attribute_end));
+    EXPECT_EQ (stats.get_tokens (dot::token::label_assignment),
+	       stats.get_tokens (dot::token::label_value));
+
+    // memory is allocated and time is spent in all phases
+    EXPECT_GT (stats.allocations, 0);
+    EXPECT_GE (stats.allocated_bytes, stats.peak_memory);
+    EXPECT_GT (stats.peak_memory, 0);
+    for (size_t j = 0 ; j < dot::nbphases ; j++)
+      EXPECT_GE (stats.seconds[j], 0.0);
+  }
+}
+
+// Checks that the same tokens are counted when contents are fed in chunks than
+// when they are parsed at once, and at least as many when they are parsed in
+// parallel
+// ----------------------------------------------------------------------------
+TEST (Stats, FeedAndThreads)
+{
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    string dotgraph = randStatsGraph ();
+    dot::parser expected;
+    expected.parse_string (dotgraph);
+
+    dot::parser fed;
+    for (size_t j = 0 ; j < dotgraph.size () ; ) {
+      size_t length = min (size_t (1 + rand () % 16), dotgraph.size () - j);
+      fed.feed (dotgraph.data () + j, length);
+      j += length;
+    }
+    ASSERT_TRUE (fed.finish ());
+    EXPECT_EQ (expected.get_stats ().tokens, fed.get_stats ().tokens);
+    EXPECT_EQ (expected.get_stats ().nb_statements, fed.get_stats ().nb_statements);
+    EXPECT_EQ (dotgraph.size (), fed.get_stats ().bytes);
+    EXPECT_GT (fed.get_stats ().peak_pending, 0);
+
+    // when reading in parallel, some statements are read more than once
+    dot::parser parallel;
+    ASSERT_TRUE (parallel.parse_string (dotgraph, 3));
+    for (size_t j = 0 ; j < dot::nbtokens ; j++)
+      EXPECT_GE (parallel.get_stats ().tokens[j], expected.get_stats ().tokens[j]);
+    EXPECT_GE (parallel.get_stats ().nb_statements, expected.get_stats ().nb_statements);
+    EXPECT_EQ (dotgraph.size (), parallel.get_stats ().bytes);
+    EXPECT_EQ (expected.get_stats ().nb_edges, parallel.get_stats ().nb_edges);
+  }
+}
+
+// Checks that the contents following a syntax error are not kept pending when
+// they are fed in recovery mode
+// ----------------------------------------------------------------------------
+TEST (Stats, FeedRecovery)
+{
+  string body;
+  for (auto i = 0 ; i < 1000 ; i++)
+    body += "  a" + to_string (i) + " -> b" + to_string (i) + ";\n";
+  string dotgraph = "digraph G {\n  a -> ;\n" + body + "}\n";
+  dot::parser parser;
+  parser.set_recovery ();
+  for (size_t i = 0 ; i < dotgraph.size () ; ) {
+    size_t eol = dotgraph.find ('\n', i) + 1;
+    parser.feed (dotgraph.data () + i, eol - i);
+    i = eol;
+  }
+  EXPECT_FALSE (parser.finish ());
+  EXPECT_EQ (2000, parser.get_nb_vertices ());
+  EXPECT_GT (parser.get_stats ().peak_pending, 0);
+  EXPECT_LT (parser.get_stats ().peak_pending, 100);
+}
+
+// Checks that statistics are reset and shown, and that the memory given by the
+// user is still used
+// ----------------------------------------------------------------------------
+TEST (Stats, Clear)
+{
+  pmr::monotonic_buffer_resource resource;
+  dot::parser parser {&resource};
+  EXPECT_EQ (&resource, parser.get_memory_resource ());
+  ASSERT_TRUE (parser.parse_string ("graph G {\n  a -- b;\n}\n"));
+  EXPECT_GT (parser.get_stats ().bytes, 0);
+  EXPECT_GT (parser.get_stats ().allocations, 0);
+
+  stringstream stream;
+  stream << parser.get_stats ();
+  EXPECT_NE (string::npos, stream.str ().find ("EDGE_TYPE"));
+  EXPECT_NE (string::npos, stream.str ().find ("graph updates (seconds)"));
+
+  // the counters of the parsing process are reset, but not the size of the
+  // graph
+  parser.clear_stats ();
+  dot::stats stats = parser.get_stats ();
+  EXPECT_EQ (0, stats.bytes);
+  EXPECT_EQ (0, stats.get_tokens (dot::token::edge_type));
+  EXPECT_EQ (0, stats.nb_statements);
+  EXPECT_EQ (0.0, stats.get_seconds (dot::phase::graph_updates));
+  EXPECT_EQ (2, stats.nb_vertices);
+  EXPECT_EQ (2, stats.nb_edges);
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,55 @@
+/*
+  TSTthreads.cc
+  Description: DOTthreads unit test cases
+  Started on  <Sat Oct 17 23:52:30 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <atomic>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that all threads of a group are over once they are joined
+// ----------------------------------------------------------------------------
+TEST (Threads, Join)
+{
+  atomic<int> counter {0};
+  dot::thread_group threads;
+  for (auto i = 0 ; i < 8 ; i++)
+    threads.spawn ([&] (int value) { counter += value; }, i);
+  threads.join ();
+  EXPECT_EQ (28, counter);
+
+  // joining again has no effect
+  threads.join ();
+  EXPECT_EQ (28, counter);
+}
+
+// Checks that all threads of a group are joined when an exception is raised
+// after starting them, instead of terminating the program
+// ----------------------------------------------------------------------------
+TEST (Threads, Unwind)
+{
+  atomic<int> counter {0};
+  try {
+    dot::thread_group threads;
+    for (auto i = 0 ; i < 8 ; i++)
+      threads.spawn ([&] () { counter++; });
+    throw runtime_error ("a thread could not be started");
+  } catch (const runtime_error&) {
+    EXPECT_EQ (8, counter);
+  }
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,264 @@
+/*
+  TSTtrace.cc
+  Description: DOTtrace unit test cases
+  Started on  <Sat Oct 17 20:58:36 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// every event is copied as a tuple (kind, offset, label, value)
+using event_copy = tuple<dot::token, uint64_t, string, string>;
+
+// sink which copies all events, and records the size of every batch
+struct copy_sink : public dot::trace_sink {
+
+  vector<event_copy> events;
+  vector<size_t> batches;
+
+  void write (const dot::trace_event* events, size_t nbevents)
+  {
+    for (size_t i = 0 ; i < nbevents ; i++)
+      this->events.emplace_back (events[i].kind, events[i].offset,
+				 string (events[i].label), string (events[i].value));
+    batches.push_back (nbevents);
+  }
+};
+
+// return a random graph with labels, attributes, comments and blocks of
+// multiple vertices
+string randTraceGraph (int nbnodestmts, int nbedges)
+{
+  vector<string> vertices;
+  map<string, vector<string>> edges;
+  map<string, string> labels;
+  map<string, map<string, string>> vertexattrs;
+  map<string, map<string, map<string, string>>> edgeattrs;
+  return randGraph (nbnodestmts, 50, 5, nbedges, 10, 1 + rand () % 5, 4, 4, randString (10),
+		    DIRECTED_GRAPH, MIX_EDGE,
+		    vertices, edges, labels, vertexattrs, edgeattrs);
+}
+
+// Checks that all tokens are traced in the same order they are given, with
+// their offsets and values
+// ----------------------------------------------------------------------------
+TEST (Trace, Events)
+{
+  ASSERT_TRUE (dot::tracer::enabled);
+
+  string dotgraph = "digraph G {\n"
+    "  rankdir = \"LR\";\n"
+    "  a [color=red];\n"
+    "  a -> { b }\n"
+    "}\n";
+  vector<event_copy> expected {
+    {dot::token::graph_type, 0, "TYPE", "digraph"},
+    {dot::token::graph_name, 8, "NAME", "G"},
+    {dot::token::block_begin, 10, "--- Block begin found ---", ""},
+    {dot::token::label_assignment, 14, "LABEL ID", "rankdir"},
+    {dot::token::label_value, 24, "LABEL VALUE", "\"LR\""},
+    {dot::token::vertex_name, 32, "SOURCE_VERTEX", "a"},
+    {dot::token::attribute_name, 35, "\tATTRIBUTE", "color"},
+    {dot::token::attribute_value_end, 41, "\tVALUE (*)", "red"},
+    {dot::token::vertex_name, 49, "SOURCE_VERTEX", "a"},
+    {dot::token::edge_type, 51, "EDGE TYPE", "->"},
+    {dot::token::block_begin, 54, " --- Beginning multiple target specification ---", ""},
+    {dot::token::vertex_name, 56, "TARGET VERTEX", "b"},
+    {dot::token::block_end, 58, " --- Ending multiple target specification ---", ""},
+    {dot::token::block_end, 60, " --- Block end found ---", ""}};
+
+  copy_sink sink;
+  dot::parser parser;
+  parser.set_trace (&sink);
+  ASSERT_TRUE (parser.parse_string (dotgraph));
+  EXPECT_EQ (expected, sink.events);
+  EXPECT_EQ (1, sink.batches.size ());
+}
+
+// Checks that the offsets of the tokens traced in random graphs locate them in
+// the contents
+// ----------------------------------------------------------------------------
+TEST (Trace, Offsets)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    string dotgraph = randTraceGraph (10, 10);
+    copy_sink sink;
+    dot::parser parser;
+    parser.set_trace (&sink);
+    ASSERT_TRUE (parser.parse_string (dotgraph));
+
+    ASSERT_FALSE (sink.events.empty ());
+    uint64_t last = 0;
+    for (auto& [kind, offset, label, value] : sink.events) {
+      ASSERT_LT (offset, dotgraph.size ());
+      ASSERT_LE (last, offset);
+      if (value.empty ())
+	ASSERT_NE (string::npos, string ("{}").find (dotgraph[offset]));
+      else
+	ASSERT_EQ (value, dotgraph.substr (offset, value.size ()));
+      last = offset;
+    }
+  }
+}
+
+// Checks that the same events are traced when contents are fed in chunks or
+// parsed in parallel than when they are parsed at once
+// ----------------------------------------------------------------------------
+TEST (Trace, FeedAndThreads)
+{
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    string dotgraph = randTraceGraph (10, 10);
+    copy_sink expected;
+    dot::parser parser;
+    parser.set_trace (&expected);
+    parser.parse_string (dotgraph);
+
+    copy_sink fed;
+    dot::parser incremental;
+    incremental.set_trace (&fed);
+    for (size_t j = 0 ; j < dotgraph.size () ; ) {
+      size_t length = min (size_t (1 + rand () % 16), dotgraph.size () - j);
+      incremental.feed (dotgraph.data () + j, length);
+      j += length;
+    }
+    ASSERT_TRUE (incremental.finish ());
+    EXPECT_EQ (expected.events, fed.events);
+
+    copy_sink parallel;
+    dot::parser threads;
+    threads.set_trace (&parallel);
+    ASSERT_TRUE (threads.parse_string (dotgraph, 3));
+    EXPECT_EQ (expected.events, parallel.events);
+  }
+}
+
+// Checks that events are given in batches, and that those read before a
+// syntax error are given as well
+// ----------------------------------------------------------------------------
+TEST (Trace, Batches)
+{
+  string dotgraph = randTraceGraph (1000, 1000);
+  copy_sink sink;
+  dot::parser parser;
+  parser.set_trace (&sink);
+  parser.parse_string (dotgraph);
+  ASSERT_LT (1, sink.batches.size ());
+  for (auto batch : sink.batches)
+    EXPECT_GE (dot::tracer::batch, batch);
+
+  // once the trace is disabled, no more events are given
+  size_t nbevents = sink.events.size ();
+  dot::parser other;
+  other.set_trace (&sink);
+  other.set_trace (nullptr);
+  other.parse_string (dotgraph);
+  EXPECT_EQ (nbevents, sink.events.size ());
+
+  copy_sink error;
+  dot::parser wrong;
+  wrong.set_trace (&error);
+  EXPECT_THROW (wrong.parse_string ("graph G {\n  a -- b;\n  c -- ;\n}\n"), dot::syntax_error);
+  ASSERT_FALSE (error.events.empty ());
+  EXPECT_EQ ("--", get<3> (error.events.back ()));
+}
+
+// Checks that ring sinks keep only the last events
+// ----------------------------------------------------------------------------
+TEST (Trace, Ring)
+{
+  EXPECT_THROW (dot::ring_sink (0), invalid_argument);
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    string dotgraph = randTraceGraph (10, 10);
+    copy_sink expected;
+    dot::parser parser;
+    parser.set_trace (&expected);
+    parser.parse_string (dotgraph);
+
+    size_t capacity = 1 + rand () % (2 * expected.events.size ());
+    dot::ring_sink ring {capacity};
+    dot::parser other;
+    other.set_trace (&ring);
+    other.parse_string (dotgraph);
+    ASSERT_EQ (min (capacity, expected.events.size ()), ring.size ());
+    size_t first = expected.events.size () - ring.size ();
+    for (size_t j = 0 ; j < ring.size () ; j++) {
+      EXPECT_EQ (get<0> (expected.events[first + j]), ring[j].kind);
+      EXPECT_EQ (get<1> (expected.events[first + j]), ring[j].offset);
+      EXPECT_EQ (get<3> (expected.events[first + j]), ring[j].value);
+    }
+
+    ring.clear ();
+    EXPECT_EQ (0, ring.size ());
+  }
+}
+
+// Checks that stream and file sinks write every event in a line, and that
+// callback sinks give them to the callback
+// ----------------------------------------------------------------------------
+TEST (Trace, Sinks)
+{
+  string dotgraph = "graph G {\n  a -- b [w=1];\n}\n";
+
+  stringstream stream;
+  dot::stream_sink sink {stream};
+  dot::parser parser;
+  parser.set_trace (&sink);
+  parser.parse_string (dotgraph);
+  EXPECT_EQ ("0 [TYPE graph]\n"
+	     "6 [NAME G]\n"
+	     "8 [--- Block begin found ---]\n"
+	     "12 [SOURCE_VERTEX a]\n"
+	     "14 [EDGE TYPE --]\n"
+	     "17 [TARGET VERTEX b]\n"
+	     "20 [\tATTRIBUTE w]\n"
+	     "22 [\tVALUE (*) 1]\n"
+	     "26 [ --- Block end found ---]\n", stream.str ());
+
+  string filename = writeTemporaryFile ("");
+  ASSERT_NE ("", filename);
+  {
+    dot::file_sink file {filename};
+    dot::parser other;
+    other.set_trace (&file);
+    other.parse_string (dotgraph);
+  }
+  ifstream input {filename};
+  stringstream contents;
+  contents << input.rdbuf ();
+  EXPECT_EQ (stream.str (), contents.str ());
+  remove (filename.c_str ());
+  EXPECT_THROW (dot::file_sink ("/this/directory/does/not/exist/trace"), invalid_argument);
+
+  size_t nbevents = 0;
+  dot::callback_sink callback {[&nbevents] (const dot::trace_event*, size_t n) { nbevents += n; }};
+  dot::parser last;
+  last.set_trace (&callback);
+  last.parse_string (dotgraph);
+  EXPECT_EQ (9, nbevents);
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,197 @@
+/*
+  TSTtraversal.cc
+  Description: DOTtraversal unit test cases
+  Started on  <Sat Oct 17 23:40:12 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <deque>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// compute the preorder and postorder of a recursive depth-first traversal from
+// the given vertex using the names of the vertices
+void recursiveDFS (dot::parser& parser, const string& vertex, set<string>& visited,
+		   vector<uint32_t>& preorder, vector<uint32_t>& postorder)
+{
+  visited.insert (vertex);
+  preorder.push_back (parser.get_vertex_id (vertex));
+  for (auto& target : parser.get_neighbours (vertex))
+    if (visited.find (target) == visited.end ())
+      recursiveDFS (parser, target, visited, preorder, postorder);
+  postorder.push_back (parser.get_vertex_id (vertex));
+}
+
+// return the level of every vertex in a breadth-first traversal from the given
+// vertex using the names of the vertices
+map<string, uint32_t> namedBFS (dot::parser& parser, const string& source)
+{
+  map<string, uint32_t> levels {{source, 0}};
+  deque<string> queue {source};
+  while (!queue.empty ()) {
+    string vertex = queue.front ();
+    queue.pop_front ();
+    for (auto& target : parser.get_neighbours (vertex))
+      if (levels.find (target) == levels.end ()) {
+	levels[target] = levels[vertex] + 1;
+	queue.push_back (target);
+      }
+  }
+  return levels;
+}
+
+// Checks that vertices are added to and removed from sets of vertices
+// ----------------------------------------------------------------------------
+TEST (Traversal, VertexSet)
+{
+  dot::vertex_set empty;
+  EXPECT_TRUE (empty.empty ());
+  EXPECT_FALSE (empty.contains (0));
+
+  dot::vertex_set vertices {200};
+  EXPECT_EQ (200, vertices.get_nb_vertices ());
+  for (uint32_t id : {199, 0, 64, 63, 128})
+    EXPECT_TRUE (vertices.insert (id));
+  EXPECT_FALSE (vertices.insert (64));
+  EXPECT_EQ (5, vertices.size ());
+  EXPECT_TRUE (vertices.contains (63));
+  EXPECT_FALSE (vertices.contains (62));
+  EXPECT_FALSE (vertices.contains (200));
+  EXPECT_EQ (vector<uint32_t> ({0, 63, 64, 128, 199}), vertices.get_ids ());
+
+  vertices.clear ();
+  EXPECT_TRUE (vertices.empty ());
+  EXPECT_FALSE (vertices.contains (199));
+  EXPECT_EQ (vector<uint32_t> (), vertices.get_ids ());
+}
+
+// Checks the levels, preorder, postorder and vertices reached in a small
+// graph
+// ----------------------------------------------------------------------------
+TEST (Traversal, Kernels)
+{
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string ("digraph G {\n"
+				    "  a -> { b c }\n"
+				    "  b -> d -> a\n"
+				    "  c -> d\n"
+				    "  e -> a\n"
+				    "  f;\n"
+				    "}\n"));
+  uint32_t a = parser.get_vertex_id ("a");
+  uint32_t b = parser.get_vertex_id ("b");
+  uint32_t c = parser.get_vertex_id ("c");
+  uint32_t d = parser.get_vertex_id ("d");
+  uint32_t e = parser.get_vertex_id ("e");
+  uint32_t f = parser.get_vertex_id ("f");
+
+  EXPECT_EQ (vector<uint32_t> ({a, b, c, d}), dot::reachable (parser, a).get_ids ());
+  EXPECT_EQ (vector<uint32_t> ({a, b, c, d, e}), dot::reachable (parser, e).get_ids ());
+  EXPECT_EQ (vector<uint32_t> ({f}), dot::reachable (parser, f).get_ids ());
+
+  EXPECT_EQ (vector<uint32_t> ({0, 1, 1, 2, dot::unreached, dot::unreached}),
+	     dot::bfs_levels (parser, a));
+  EXPECT_EQ (vector<uint32_t> ({1, 2, 2, 3, 0, dot::unreached}), dot::bfs_levels (parser, e));
+
+  dot::dfs_order order = dot::dfs (parser, e);
+  EXPECT_EQ (vector<uint32_t> ({e, a, b, d, c}), order.preorder);
+  EXPECT_EQ (vector<uint32_t> ({d, b, c, a, e}), order.postorder);
+
+  EXPECT_THROW (dot::reachable (parser, 6), out_of_range);
+  EXPECT_THROW (dot::bfs_levels (parser, 6), out_of_range);
+  EXPECT_THROW (dot::dfs (parser, 6), out_of_range);
+}
+
+// Checks that random graphs are traversed precisely as with the names of their
+// vertices, both in parsers and snapshots
+// ----------------------------------------------------------------------------
+TEST (Traversal, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+    dot::parser parser;
+    ASSERT_TRUE (parser.parse_string (dotgraph));
+    string filename = writeTemporaryFile ("");
+    ASSERT_NE ("", filename);
+    dot::snapshot::save (parser, filename);
+    dot::snapshot snapshot {filename};
+    ASSERT_TRUE (snapshot.load ());
+
+    for (uint32_t source = 0 ; source < parser.get_nb_vertices () ; source++) {
+      string name {parser.get_vertex_name (source)};
+
+      set<string> visited;
+      vector<uint32_t> preorder, postorder;
+      recursiveDFS (parser, name, visited, preorder, postorder);
+      dot::dfs_order order = dot::dfs (parser, source);
+      ASSERT_EQ (preorder, order.preorder);
+      ASSERT_EQ (postorder, order.postorder);
+      ASSERT_EQ (preorder, dot::dfs (snapshot, source).preorder);
+
+      vector<uint32_t> levels (parser.get_nb_vertices (), dot::unreached);
+      vector<uint32_t> reached;
+      for (auto& [vertex, level] : namedBFS (parser, name)) {
+	levels[parser.get_vertex_id (vertex)] = level;
+	reached.push_back (parser.get_vertex_id (vertex));
+      }
+      sort (reached.begin (), reached.end ());
+      ASSERT_EQ (levels, dot::bfs_levels (parser, source));
+      ASSERT_EQ (levels, dot::bfs_levels (snapshot, source));
+      ASSERT_EQ (reached, dot::reachable (parser, source).get_ids ());
+      ASSERT_EQ (reached.size (), dot::reachable (snapshot, source).size ());
+    }
+    remove (filename.c_str ());
+  }
+}
+
+// Checks that graphs of any depth are traversed
+// ----------------------------------------------------------------------------
+TEST (Traversal, Depth)
+{
+  const uint32_t nbvertices = 200000;
+  string dotgraph = "digraph G {\n";
+  for (uint32_t id = 0 ; id + 1 < nbvertices ; id++)
+    dotgraph += "  v" + to_string (id) + " -> v" + to_string (id + 1) + ";\n";
+  dotgraph += "}\n";
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string (dotgraph));
+
+  dot::dfs_order order = dot::dfs (parser, 0);
+  ASSERT_EQ (nbvertices, order.preorder.size ());
+  ASSERT_EQ (nbvertices, order.postorder.size ());
+  for (uint32_t id = 0 ; id < nbvertices ; id++) {
+    ASSERT_EQ (id, order.preorder[id]);
+    ASSERT_EQ (nbvertices - 1 - id, order.postorder[id]);
+  }
+  vector<uint32_t> levels = dot::bfs_levels (parser, 0);
+  EXPECT_EQ (nbvertices - 1, levels.back ());
+  EXPECT_EQ (nbvertices, dot::reachable (parser, 0).size ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,121 @@
+/*
+  TSTvalue.cc
+  Description: DOTvalue unit test cases
+  Started on  <Sat Oct 17 15:02:44 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+#include <memory_resource>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// Checks that random integers are decoded as integers
+// ----------------------------------------------------------------------------
+TEST (Value, Integers)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    string text = randInt (1000000);
+    dot::value value {text};
+    ASSERT_EQ (dot::value::kind::integer, value.get_kind ());
+    ASSERT_TRUE (value.is_number ());
+    ASSERT_EQ (text, value.get_text ());
+    ASSERT_EQ (stoll (text), value.get<long long> ());
+    ASSERT_EQ (stoi (text), value.get<int> ());
+    ASSERT_EQ (stod (text), value.get<double> ());
+    ASSERT_EQ (text, value.get<string> ());
+  }
+
+  // a leading plus sign is accepted, and integers which do not fit in 64 bits
+  // are decoded as floating-point numbers
+  EXPECT_EQ (42, dot::value {"+42"}.get<int> ());
+  EXPECT_EQ (numeric_limits<int64_t>::min (), dot::value {"-9223372036854775808"}.get<int64_t> ());
+  dot::value large {"123456789012345678901234567890"};
+  EXPECT_EQ (dot::value::kind::floating, large.get_kind ());
+  EXPECT_DOUBLE_EQ (1.2345678901234568e29, large.get<double> ());
+}
+
+// Checks that random floating-point numbers are decoded as floating-point
+// numbers
+// ----------------------------------------------------------------------------
+TEST (Value, Floats)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+    string text = randFloat (1000);
+    dot::value value {text};
+    ASSERT_TRUE (value.is_number ()) << text << endl;
+    ASSERT_EQ (text, value.get_text ());
+    ASSERT_EQ (stod (text), value.get<double> ()) << text << endl;
+  }
+
+  for (string text : {"1.5", "-.5", "+2.", "1e3", "1E-3", "-0.25e+2"}) {
+    dot::value value {text};
+    EXPECT_EQ (dot::value::kind::floating, value.get_kind ()) << text << endl;
+    EXPECT_EQ (stod (text), value.get<double> ()) << text << endl;
+  }
+  EXPECT_EQ (2, dot::value {"2.75"}.get<int> ());
+}
+
+// Checks that values which are not numbers are kept as strings
+// ----------------------------------------------------------------------------
+TEST (Value, Strings)
+{
+  for (string text : {"", "red", "1.2.3", "12a", "-", "+", ".", "e5", "1e", "1e+",
+		      "inf", "nan", "0x1F", " 12", "12 ", "1,5"}) {
+    dot::value value {text};
+    EXPECT_EQ (dot::value::kind::string, value.get_kind ()) << text << endl;
+    EXPECT_FALSE (value.is_number ()) << text << endl;
+    EXPECT_EQ (text, value.get<string> ());
+    EXPECT_THROW (value.get<double> (), invalid_argument) << text << endl;
+  }
+
+  // values are decoded again when a new text is assigned
+  dot::value value {"red"};
+  value = "7";
+  EXPECT_EQ (7, value.get<int> ());
+  value = "blue";
+  EXPECT_THROW (value.get<int> (), invalid_argument);
+}
+
+// Checks that values take their memory from the containers they are stored in
+// ----------------------------------------------------------------------------
+TEST (Value, Allocator)
+{
+
+  // no memory can be taken from the default resource, so that long texts
+  // raise an exception unless they are taken from the arena
+  pmr::monotonic_buffer_resource arena;
+  pmr::map<pmr::string, dot::value, less<>> values {&arena};
+  string name (100, 'n'), text (100, 'x');
+  pmr::memory_resource* resource = pmr::set_default_resource (pmr::null_memory_resource ());
+  EXPECT_NO_THROW (values.emplace (name, text));
+  EXPECT_NO_THROW (values.emplace ("number", "3.25"));
+  EXPECT_THROW (dot::value {text}, bad_alloc);
+  pmr::set_default_resource (resource);
+
+  // and values are copied and moved along with their numbers
+  EXPECT_EQ (text, values.find (string_view (name))->second.get<string> ());
+  dot::value copy {values.at ("number")};
+  EXPECT_EQ (3.25, copy.get<double> ());
+  dot::value moved {std::move (copy), pmr::polymorphic_allocator<char> {&arena}};
+  EXPECT_EQ (3.25, moved.get<double> ());
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
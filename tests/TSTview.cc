@@ -0,0 +1,163 @@
+/*
+  TSTview.cc
+  Description: DOTview unit test cases
+  Started on  <Fri Oct 16 18:40:52 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return true if the given view is part of the given contents
+bool isPartOf (string_view view, string_view contents)
+{
+  return view.data () >= contents.data () &&
+    view.data () + view.size () <= contents.data () + contents.size ();
+}
+
+// Checks that views parse random graphs precisely in the same way than parsers
+// ----------------------------------------------------------------------------
+TEST (View, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::parser parser;
+    parser.parse_string (dotgraph);
+    dot::view view;
+    ASSERT_TRUE (view.parse_string (dotgraph));
+
+    ASSERT_EQ (parser.get_type (), view.get_type ());
+    ASSERT_EQ (parser.get_name (), view.get_name ());
+    ASSERT_EQ (parser.get_vertices (), toStrings (view.get_vertices ()));
+    ASSERT_EQ (parser.get_labels (), toStrings (view.get_labels ()));
+    for (auto& label : parser.get_labels ())
+      ASSERT_EQ (parser.get_label_value (label), view.get_label_value (label));
+
+    ASSERT_EQ (parser.get_all_vertex_attributes ().size (), view.get_all_vertex_attributes ().size ());
+    ASSERT_EQ (parser.get_all_edge_attributes ().size (), view.get_all_edge_attributes ().size ());
+
+    // check the neighbours and attributes of all vertices
+    for (auto& vertex : parser.get_vertices ()) {
+      ASSERT_EQ (parser.get_neighbours (vertex), toStrings (view.get_neighbours (vertex)));
+      ASSERT_EQ (parser.get_vertex_attributes (vertex), toStrings (view.get_vertex_attributes (vertex)));
+      for (auto& neighbour : parser.get_neighbours (vertex)) {
+	ASSERT_EQ (parser.get_edge_attributes (vertex, neighbour),
+		   toStrings (view.get_edge_attributes (vertex, neighbour)));
+	for (auto& attr : parser.get_edge_attributes (vertex, neighbour))
+	  ASSERT_EQ (parser.get_edge_attribute (vertex, neighbour, attr.first),
+		     view.get_edge_attribute (vertex, neighbour, attr.first));
+      }
+    }
+  }
+}
+
+// Checks that all names and values are views over the contents
+// ----------------------------------------------------------------------------
+TEST (View, ZeroCopy)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				DIRECTED_GRAPH, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+
+    dot::view view;
+    view.parse_string (dotgraph);
+    string_view contents = view.get_contents ();
+    ASSERT_EQ (dotgraph, contents);
+
+    ASSERT_TRUE (isPartOf (view.get_name (), contents));
+    for (auto& label : view.get_labels ()) {
+      ASSERT_TRUE (isPartOf (label, contents));
+      ASSERT_TRUE (isPartOf (view.get_label_value (label), contents));
+    }
+    for (auto& vertex : view.get_all_vertex_attributes ())
+      for (auto& attr : vertex.second) {
+	ASSERT_TRUE (isPartOf (attr.first, contents));
+	ASSERT_TRUE (isPartOf (attr.second, contents));
+      }
+    for (auto& vertex : view.get_vertices ()) {
+      ASSERT_TRUE (isPartOf (vertex, contents));
+      for (auto& neighbour : view.get_neighbours (vertex))
+	ASSERT_TRUE (isPartOf (neighbour, contents));
+    }
+  }
+}
+
+// Checks that errors are reported as in the dot parser
+// ----------------------------------------------------------------------------
+TEST (View, Errors)
+{
+  dot::view view ("/this/file/does/not/exist.dot");
+  EXPECT_THROW (view.parse (), invalid_argument);
+
+  EXPECT_THROW (view.parse_string ("digraph G {\n a -> ;\n}\n"), dot::syntax_error);
+
+  ASSERT_TRUE (view.parse_string ("digraph G {\n a -> b [w=1];\n}\n"));
+  EXPECT_THROW (view.get_neighbours ("c"), dot::syntax_error);
+  EXPECT_THROW (view.get_edge_attributes ("b", "a"), dot::syntax_error);
+  EXPECT_THROW (view.get_vertex_attribute ("a", "w"), dot::syntax_error);
+  EXPECT_EQ ("1", view.get_vertex_attribute ("b", "w"));
+
+  // edges with attributes but none with the given name raise an exception,
+  // whereas edges with no attributes at all have empty values, as in the dot
+  // parser
+  ASSERT_TRUE (view.parse_string ("digraph G {\n a -> [w=1] b;\n a -> c;\n}\n"));
+  EXPECT_EQ ("1", view.get_edge_attribute ("a", "b", "w"));
+  EXPECT_THROW (view.get_edge_attribute ("a", "b", "x"), dot::syntax_error);
+  EXPECT_EQ ("", view.get_edge_attribute ("a", "c", "w"));
+  EXPECT_THROW (view.get_edge_attribute ("a", "d", "w"), dot::syntax_error);
+  EXPECT_THROW (view.get_edge_attribute ("d", "a", "w"), dot::syntax_error);
+}
+
+// Checks that repeated edges are stored only once, even if they are given many
+// times in both directions
+// ----------------------------------------------------------------------------
+TEST (View, RepeatedEdges)
+{
+  string dotgraph = "graph G {\n";
+  for (auto i = 0 ; i < 1000 ; i++)
+    dotgraph += "  a -- b" + to_string (i % 100) + ";\n  b" + to_string (i % 100) + " -- a;\n";
+  dotgraph += "}\n";
+
+  dot::parser parser;
+  parser.parse_string (dotgraph);
+  dot::view view;
+  ASSERT_TRUE (view.parse_string (dotgraph));
+  ASSERT_EQ (100, view.get_neighbours ("a").size ());
+  for (auto& vertex : parser.get_vertices ())
+    ASSERT_EQ (parser.get_neighbours (vertex), toStrings (view.get_neighbours (vertex)));
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,226 @@
+/*
+  TSTwriter.cc
+  Description: DOTwriter unit test cases
+  Started on  <Sat Oct 17 22:51:03 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "TSTdefs.h"
+#include "TSThelperfunctions.h"
+
+#include "../dot.h"
+
+// return the given graph written with the given layout
+string writeGraph (const dot::parser& parser, dot::writer::layout layout)
+{
+  stringstream stream;
+  dot::writer writer {layout};
+  uint64_t nbbytes = writer.write (parser, stream);
+  EXPECT_EQ (nbbytes, stream.str ().size ());
+  return stream.str ();
+}
+
+// return the neighbours of the given vertex sorted in ascending order
+vector<uint32_t> sortedNeighbours (const dot::parser& parser, uint32_t id)
+{
+  vector<uint32_t> neighbours (parser.get_neighbour_ids (id).begin (),
+			       parser.get_neighbour_ids (id).end ());
+  sort (neighbours.begin (), neighbours.end ());
+  return neighbours;
+}
+
+// Checks that graphs are written with the pretty and the compact layouts
+// ----------------------------------------------------------------------------
+TEST (Writer, Layouts)
+{
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string ("digraph G {\n"
+				    "  rankdir = LR;\n"
+				    "  a [color=red, w=1.5];\n"
+				    "  a -> b; a -> c; a -> [w=2] d; a -> e\n"
+				    "  b -> a\n"
+				    "}\n"));
+  EXPECT_EQ ("digraph G {\n"
+	     "\trankdir = LR;\n"
+	     "\ta [color=red, w=1.5];\n"
+	     "\tb;\n"
+	     "\tc;\n"
+	     "\td;\n"
+	     "\te;\n"
+	     "\ta -> b;\n"
+	     "\ta -> c;\n"
+	     "\ta -> [w=2] d;\n"
+	     "\ta -> e;\n"
+	     "\tb -> a;\n"
+	     "}\n", writeGraph (parser, dot::writer::layout::pretty));
+  EXPECT_EQ ("digraph G{\n"
+	     "rankdir=LR;\n"
+	     "a[color=red,w=1.5];\n"
+	     "b;\n"
+	     "c;\n"
+	     "d;\n"
+	     "e;\n"
+	     "a->{b c};\n"
+	     "a->[w=2]d;\n"
+	     "a->e;\n"
+	     "b->a;\n"
+	     "}\n", writeGraph (parser, dot::writer::layout::compact));
+
+  // in undirected graphs, edges are undirected only if they are given in
+  // both directions with the same attributes
+  dot::parser undirected;
+  ASSERT_TRUE (undirected.parse_string ("graph {\n"
+					"  a -- b; a -- c; c -> a\n"
+					"  b -- [w=1] d; b -> [w=2] e; e -> [w=3] b\n"
+					"}\n"));
+  EXPECT_EQ ("graph{\n"
+	     "a;\n"
+	     "b;\n"
+	     "c;\n"
+	     "d;\n"
+	     "e;\n"
+	     "a--{b c};\n"
+	     "b--[w=1]d;\n"
+	     "b->[w=2]e;\n"
+	     "e->[w=3]b;\n"
+	     "}\n", writeGraph (undirected, dot::writer::layout::compact));
+}
+
+// Checks that values are written with double quotes only if necessary
+// ----------------------------------------------------------------------------
+TEST (Writer, Quotes)
+{
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string ("digraph G {\n"
+				    "  l1 = -1.5e-3\n"
+				    "  l2 = \"a b\"\n"
+				    "  l3 = \"x\"\n"
+				    "  l4 = \"1a\"\n"
+				    "  l5 = \"say \"hi\"\"\n"
+				    "  a [v1=\"-2\", v2=\"1a\", v3=\"a b\", v4=\"\", v5=\"x\"\"y\"];\n"
+				    "}\n"));
+  string output = writeGraph (parser, dot::writer::layout::compact);
+  EXPECT_EQ ("digraph G{\n"
+	     "l1=-1.5e-3;\n"
+	     "l2=\"a b\";\n"
+	     "l3=\"x\";\n"
+	     "l4=\"1a\";\n"
+	     "l5=\"say \"hi\"\";\n"
+	     "a[v1=-2,v2=1a,v3=\"a b\",v4=\"\",v5=\"x\"\"y\"];\n"
+	     "}\n", output);
+
+  // and the values are the same once they are parsed again
+  dot::parser other;
+  ASSERT_TRUE (other.parse_string (output));
+  EXPECT_EQ (parser.get_labels (), other.get_labels ());
+  EXPECT_EQ (parser.get_all_vertex_attributes (), other.get_all_vertex_attributes ());
+
+  // quoted strings are read one after the other, so that double quotes in a
+  // row are kept when the output is parsed again
+  dot::parser quotes;
+  ASSERT_TRUE (quotes.parse_string ("graph G {\n  a [v=\"\"\"x\"\"\"\"\"];\n}\n"));
+  EXPECT_EQ ("\"\"x\"\"\"\"", quotes.get_vertex_attribute ("a", "v"));
+  dot::parser again;
+  ASSERT_TRUE (again.parse_string (writeGraph (quotes, dot::writer::layout::pretty)));
+  EXPECT_EQ ("\"\"x\"\"\"\"", again.get_vertex_attribute ("a", "v"));
+
+  // graphs which have not been parsed can not be written
+  stringstream stream;
+  dot::writer writer;
+  EXPECT_THROW (writer.write (dot::parser (), stream), invalid_argument);
+}
+
+// Checks that random graphs are parsed precisely as they were written, with
+// both layouts
+// ----------------------------------------------------------------------------
+TEST (Writer, RandomGraphs)
+{
+  srand (time (nullptr));
+
+  for (auto i = 0 ; i < NB_TESTS ; i++) {
+
+    vector<string> vertices;
+    map<string, vector<string>> edges;
+    map<string, string> labels;
+    map<string, map<string, string>> vertexattrs;
+    map<string, map<string, map<string, string>>> edgeattrs;
+    int type = rand () % 2 ? UNDIRECTED_GRAPH : DIRECTED_GRAPH;
+    string dotgraph {randGraph (10, 50, 5, 10, 10, 1 + rand () % 5, 4, 4, randString (10),
+				type, MIX_EDGE,
+				vertices, edges, labels, vertexattrs, edgeattrs)};
+    dot::parser expected;
+    ASSERT_TRUE (expected.parse_string (dotgraph));
+
+    for (auto layout : {dot::writer::layout::pretty, dot::writer::layout::compact}) {
+      dot::parser parser;
+      ASSERT_TRUE (parser.parse_string (writeGraph (expected, layout)));
+
+      ASSERT_EQ (expected.get_type (), parser.get_type ());
+      ASSERT_EQ (expected.get_name (), parser.get_name ());
+      ASSERT_EQ (expected.get_labels (), parser.get_labels ());
+      ASSERT_EQ (expected.get_all_vertex_attributes (), parser.get_all_vertex_attributes ());
+      ASSERT_EQ (expected.get_all_edge_attributes (), parser.get_all_edge_attributes ());
+
+      // vertices are given the same identifiers. Neighbours are kept in the
+      // same order only in directed graphs
+      ASSERT_EQ (expected.get_nb_vertices (), parser.get_nb_vertices ());
+      for (uint32_t id = 0 ; id < expected.get_nb_vertices () ; id++) {
+	ASSERT_EQ (expected.get_vertex_name (id), parser.get_vertex_name (id));
+	if (type == DIRECTED_GRAPH)
+	  ASSERT_EQ (expected.get_neighbour_ids (id), parser.get_neighbour_ids (id));
+	else
+	  ASSERT_EQ (sortedNeighbours (expected, id), sortedNeighbours (parser, id));
+      }
+    }
+  }
+}
+
+// Checks that graphs are written into files, and that the compact layout is
+// shorter than the pretty one
+// ----------------------------------------------------------------------------
+TEST (Writer, Files)
+{
+  vector<string> vertices;
+  map<string, vector<string>> edges;
+  map<string, string> labels;
+  map<string, map<string, string>> vertexattrs;
+  map<string, map<string, map<string, string>>> edgeattrs;
+  dot::parser parser;
+  ASSERT_TRUE (parser.parse_string (randGraph (100, 50, 5, 100, 10, 3, 4, 4, "G",
+					       DIRECTED_GRAPH, MIX_EDGE,
+					       vertices, edges, labels, vertexattrs, edgeattrs)));
+
+  string filename = writeTemporaryFile ("");
+  ASSERT_NE ("", filename);
+  dot::writer writer {dot::writer::layout::compact};
+  EXPECT_EQ (dot::writer::layout::compact, writer.get_layout ());
+  uint64_t nbbytes = writer.write (parser, filename);
+  ifstream input {filename};
+  stringstream contents;
+  contents << input.rdbuf ();
+  EXPECT_EQ (writeGraph (parser, dot::writer::layout::compact), contents.str ());
+  EXPECT_EQ (contents.str ().size (), nbbytes);
+  remove (filename.c_str ());
+
+  writer.set_layout (dot::writer::layout::pretty);
+  EXPECT_LT (nbbytes, writer.write (parser, filename));
+  remove (filename.c_str ());
+  EXPECT_THROW (writer.write (parser, "/this/directory/does/not/exist/graph.dot"), invalid_argument);
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */
@@ -0,0 +1,131 @@
+/*
+  dotgen.cc
+  Description: Generator of large synthetic graphs in the DOT language
+  Started on  <Sat Oct 17 18:58:20 2026>
+  -----------------------------------------------------------------------------
+  Made by Carlos Linares López
+  Login   <carlos.linares@uc3m.es>
+*/
+
+// Usage: dotgen [options]
+//
+// It writes a synthetic graph in the DOT language into the standard output or
+// the given file. The same graph is written for the same options, and the
+// output is streamed so that graphs of any size can be generated. Run dotgen
+// --help to see all options.
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <getopt.h>
+
+#include "../dot.h"
+
+using namespace std;
+
+// show the usage of this program
+void usage (const char* program)
+{
+  printf ("Usage: %s [options]\n\n", program);
+  printf (" -n, --vertices N        number of vertices (default: 1000)\n");
+  printf (" -m, --edges N           number of edges (default: 10 per vertex)\n");
+  printf (" -s, --seed N            seed of the random numbers (default: 0)\n");
+  printf (" -x, --exponent S        exponent of the power-law distribution of degrees,\n");
+  printf ("                         zero for a uniform distribution (default: 0)\n");
+  printf (" -u, --undirected        generate an undirected graph\n");
+  printf (" -a, --vertex-attrs N:P  N vertex attributes, each with probability P\n");
+  printf (" -e, --edge-attrs N:P    N edge attributes, each with probability P\n");
+  printf (" -c, --comments P        probability of a comment per statement\n");
+  printf (" -b, --blocks N:P        blocks of up to N targets, with probability P per\n");
+  printf ("                         statement (default: 1:0)\n");
+  printf (" -p, --paths N           maximum number of edges per path (default: 1)\n");
+  printf (" -o, --output FILE       write the graph into FILE instead of the standard output\n");
+  printf (" -h, --help              show this help\n");
+}
+
+// parse an option of the form N:P, where N is an integer and P is a
+// floating-point number
+pair<int, double> parse_pair (const string& text)
+{
+  size_t colon = text.find (':');
+  if (colon == string::npos)
+    throw invalid_argument ("'" + text + "' should be given as N:P");
+  return {stoi (text.substr (0, colon)), stod (text.substr (colon + 1))};
+}
+
+int main (int argc, char** argv)
+{
+  const struct option options[] = {
+    {"vertices", required_argument, nullptr, 'n'},
+    {"edges", required_argument, nullptr, 'm'},
+    {"seed", required_argument, nullptr, 's'},
+    {"exponent", required_argument, nullptr, 'x'},
+    {"undirected", no_argument, nullptr, 'u'},
+    {"vertex-attrs", required_argument, nullptr, 'a'},
+    {"edge-attrs", required_argument, nullptr, 'e'},
+    {"comments", required_argument, nullptr, 'c'},
+    {"blocks", required_argument, nullptr, 'b'},
+    {"paths", required_argument, nullptr, 'p'},
+    {"output", required_argument, nullptr, 'o'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}
+  };
+
+  uint64_t nbvertices = 1000, nbedges = 0, seed = 0;
+  bool edges_given = false, undirected = false;
+  double exponent = 0.0, comments = 0.0;
+  pair<int, double> vertexattrs {0, 0.0}, edgeattrs {0, 0.0}, blocks {1, 0.0};
+  int maxpath = 1;
+  string output;
+
+  try {
+    int option;
+    while ((option = getopt_long (argc, argv, "n:m:s:x:ua:e:c:b:p:o:h", options, nullptr)) != -1) {
+      switch (option) {
+      case 'n': nbvertices = stoull (optarg); break;
+      case 'm': nbedges = stoull (optarg); edges_given = true; break;
+      case 's': seed = stoull (optarg); break;
+      case 'x': exponent = stod (optarg); break;
+      case 'u': undirected = true; break;
+      case 'a': vertexattrs = parse_pair (optarg); break;
+      case 'e': edgeattrs = parse_pair (optarg); break;
+      case 'c': comments = stod (optarg); break;
+      case 'b': blocks = parse_pair (optarg); break;
+      case 'p': maxpath = stoi (optarg); break;
+      case 'o': output = optarg; break;
+      case 'h': usage (argv[0]); return EXIT_SUCCESS;
+      default: usage (argv[0]); return EXIT_FAILURE;
+      }
+    }
+    if (!edges_given)
+      nbedges = 10 * nbvertices;
+
+    dot::generator generator {nbvertices, nbedges, seed};
+    generator.set_directed (!undirected);
+    generator.set_exponent (exponent);
+    generator.set_vertex_attributes (vertexattrs.first, vertexattrs.second);
+    generator.set_edge_attributes (edgeattrs.first, edgeattrs.second);
+    generator.set_comments (comments);
+    generator.set_statements (blocks.second, blocks.first, maxpath);
+
+    if (output.empty ()) {
+      ios::sync_with_stdio (false);
+      generator.generate (cout);
+    } else
+      generator.generate (output);
+  } catch (const exception& error) {
+    fprintf (stderr, " Fatal error: %s\n", error.what ());
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+/* Local Variables: */
+/* mode:c++ */
+/* fill-column:80 */
+/* End: */